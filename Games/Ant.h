@@ -66,7 +66,7 @@ public:
     uint8_t getX() const;
     uint8_t getY() const;
 
-    void move(uint8_t width = 8, uint8_t height = 8);
+    void move(uint8_t width = 8, uint8_t height = 8, bool wrap = ANT_WRAP_BOARD);
     void turn(bool clockwise = true);
 
 };
@@ -79,9 +79,9 @@ public:
  * @param {uint8_t} direction
  */
 Ant::Ant(
-    uint8_t _x = 0,
-    uint8_t _y = 0,
-    uint8_t _direction = ANT_DIRECTION_UP
+    uint8_t _x,
+    uint8_t _y,
+    uint8_t _direction
 ) {
     x = _x;
     y = _y;
@@ -109,13 +109,13 @@ Ant::Ant(
 #endif /* GAME_DEBUG */
 
 /**
- * Randomize ant location and direction
+ * Randomize ant location and direction from the game's numbers
  *
  * @param  {uint8_t} width
  * @param  {uint8_t} height
  */
 #if (ANT_RANDOMIZE)
-    void Ant::randomize(uint8_t width = 8, uint8_t height = 8 ) {
+    void Ant::randomize(uint8_t width, uint8_t height) {
         // x = 5;
         // y = 5;
         // // direction = ANT_DIRECTION_UP;
@@ -124,18 +124,10 @@ Ant::Ant(
         // // direction = ANT_DIRECTION_LEFT;
         // return;
 
-        randomSeed(analogRead(0));
-        randomSeed(analogRead(random(0, 5)));
+        x = game_random.below(width);
+        y = game_random.below(height);
 
-        x = random(0, width);
-        randomSeed(analogRead(random(0, 5)));
-        randomSeed(random(0, width));
-
-        y = random(0, height);
-        randomSeed(analogRead(random(0, 5)));
-        randomSeed(random(0, height));
-
-        direction = random(ANT_DIRECTION_UP, ANT_DIRECTION_LEFT + 1);
+        direction = (ANT_DIRECTION_UP) + game_random.below((ANT_DIRECTION_LEFT) - (ANT_DIRECTION_UP) + 1);
     }
 #endif /* ANT_RANDOMIZE */
 
@@ -158,42 +150,31 @@ uint8_t Ant::getY() const { return y; }
  *
  * @param  {uint8_t} width
  * @param  {uint8_t} height
+ * @param  {bool}    wrap    to the other side at the edge, or stay
  */
-void Ant::move(uint8_t width = 8, uint8_t height = 8) {
+void Ant::move(uint8_t width, uint8_t height, bool wrap) {
     if (direction == ANT_DIRECTION_UP) {
-        if (y == 0)
-            #if (ANT_WRAP_BOARD)
-                y = --width;
-            #else
-                ;
-            #endif /* ANT_WRAP_BOARD */
+        if (y == 0) {
+            if (wrap) y = height - 1;
+        }
         else y--;
     }
     else if (direction == ANT_DIRECTION_RIGHT) {
-        if (x == height - 1)
-            #if (ANT_WRAP_BOARD)
-                x = 0;
-            #else
-                ;
-            #endif /* ANT_WRAP_BOARD */
+        if (x == width - 1) {
+            if (wrap) x = 0;
+        }
         else x++;
     }
     else if (direction == ANT_DIRECTION_DOWN) {
-        if (y == width - 1)
-            #if (ANT_WRAP_BOARD)
-                y = 0;
-            #else
-                ;
-            #endif /* ANT_WRAP_BOARD */
+        if (y == height - 1) {
+            if (wrap) y = 0;
+        }
         else y++;
     }
     else if (direction == ANT_DIRECTION_LEFT) {
-        if (x == 0)
-            #if (ANT_WRAP_BOARD)
-                x = --height;
-            #else
-                ;
-            #endif /* ANT_WRAP_BOARD */
+        if (x == 0) {
+            if (wrap) x = width - 1;
+        }
         else x--;
     }
 }
@@ -203,7 +184,7 @@ void Ant::move(uint8_t width = 8, uint8_t height = 8) {
  *
  * @param  {bool} clockwise turn if true
  */
-void Ant::turn(bool clockwise = true) {
+void Ant::turn(bool clockwise) {
     if (clockwise) {
         if (direction == ANT_DIRECTION_LEFT) direction = ANT_DIRECTION_UP;
         else direction++;
@@ -8,6 +8,14 @@
 #include <Arduino.h>
 
 
+/*******************************************************************************
+ *                               Local Includes                                *
+ *******************************************************************************/
+
+#include "../Profile.h"
+#include "../Random.h"
+
+
 /*******************************************************************************
  *                               Board Settings                                *
  *******************************************************************************/
@@ -35,6 +43,28 @@
     #define BOARD_PRINT_CELL_STATE_DEAD false
 #endif /* BOARD_PRINT_CELL_STATE_DEAD */
 
+/**
+ * Record which cells changed state since the last `clearDirty`, as a span of
+ * columns per row, so a draw only has to touch those. Costs 2 bytes per row.
+ */
+#ifndef BOARD_TRACK_DIRTY
+    #define BOARD_TRACK_DIRTY true
+#endif /* BOARD_TRACK_DIRTY */
+
+/**
+ * Chance in 256 of a cell being alive in a random soup
+ */
+#ifndef BOARD_RANDOM_DENSITY
+    #define BOARD_RANDOM_DENSITY 96
+#endif /* BOARD_RANDOM_DENSITY */
+
+/**
+ * Mirror random soups, see Board Symmetry
+ */
+#ifndef BOARD_RANDOM_SYMMETRY
+    #define BOARD_RANDOM_SYMMETRY BOARD_SYMMETRY_NONE
+#endif /* BOARD_RANDOM_SYMMETRY */
+
 
 /*******************************************************************************
  *                              Game Settings                                *
@@ -80,6 +110,24 @@
     #define CELL_WIDTH (uint8_t)8 / CELLS_PER_BYTE
 #endif /* CELL_WIDTH */
 
+/**
+ * Bits of a cell, also the highest state it holds
+ */
+#define CELL_STATE_MASK (uint8_t)((1 << (CELL_WIDTH)) - 1)
+
+
+/*******************************************************************************
+ *                               Board Symmetry                                *
+ *******************************************************************************/
+
+/**
+ * Right half mirrors the left, bottom half the top, or both for 4 fold
+ */
+#define BOARD_SYMMETRY_NONE     0
+#define BOARD_SYMMETRY_MIRROR_X 1
+#define BOARD_SYMMETRY_MIRROR_Y 2
+#define BOARD_SYMMETRY_MIRROR_XY (BOARD_SYMMETRY_MIRROR_X | BOARD_SYMMETRY_MIRROR_Y)
+
 
 /*******************************************************************************
  *                                Cell States                                  *
@@ -101,18 +149,38 @@ class Board {
 private:
     uint8_t width;
     uint8_t height;
-    uint8_t ** board;
+
+    /**
+     * CELLS_PER_BYTE columns to a byte, a column of bytes after another
+     */
+    uint8_t * board;
 
     uint8_t num_columns;
-    uint8_t i_col_count;
 
-    uint8_t cell_col;
-    uint8_t i_cell_col;
-    uint8_t i_cell_col_value;
-    uint8_t cell_state;
+    /**
+     * Truth of the cells and dirty spans being allocated by the board, rather
+     * than kept by the caller
+     */
+    bool owns_storage;
+
+    #if (BOARD_TRACK_DIRTY)
+        /**
+         * Dirty columns of each row, none if min is past max
+         */
+        uint8_t * dirty_col_min;
+        uint8_t * dirty_col_max;
+        bool any_dirty;
+
+        void _markDirty(uint8_t x, uint8_t y);
+    #endif /* BOARD_TRACK_DIRTY */
 
-    uint8_t num_skip;
-    uint8_t max_width_height;
+    void _initStorage();
+
+    static uint8_t _spreadCells(uint8_t cells);
+    static uint8_t _reverseCells(uint8_t cells);
+
+    void _mirrorX();
+    void _mirrorY();
 
 protected:
     uint8_t i_col;
@@ -121,8 +189,17 @@ protected:
     uint8_t i_col_annex;
     uint8_t i_row_annex;
 
+    Board(
+        uint8_t _width,
+        uint8_t _height,
+        uint8_t * _board,
+        uint8_t * _dirty_col_min,
+        uint8_t * _dirty_col_max
+    );
+
 public:
     Board(uint8_t _width, uint8_t _height);
+    virtual ~Board();
 
     uint8_t getWidth() const;
     uint8_t getHeight() const;
@@ -132,20 +209,65 @@ public:
         virtual void print();
     #endif /* GAME_DEBUG */
 
-    virtual void setState(uint8_t x, uint8_t y, uint8_t state);
-    virtual void setAlive(uint8_t x, uint8_t y);
-    virtual void setDead(uint8_t x, uint8_t y);
+    /**
+     * Not virtual, like `getState`, so a call is inlined. BoardAnnex and
+     * BoardAnnexStack have their own, and keep Board as a protected base so
+     * they can't be used through a `Board *` that would skip them.
+     */
+    void setState(uint8_t x, uint8_t y, uint8_t state);
+    void setAlive(uint8_t x, uint8_t y);
+    void setDead(uint8_t x, uint8_t y);
 
     virtual void reset();
 
     virtual void copyBoard(Board * other_board);
 
-    void randomize();
+    uint32_t hash() const;
+
+    uint16_t randomize();
+    uint16_t randomize(
+        Random * random,
+        uint8_t density = BOARD_RANDOM_DENSITY,
+        uint8_t symmetry = BOARD_RANDOM_SYMMETRY
+    );
+
+    #if (BOARD_TRACK_DIRTY)
+        bool isDirty() const;
+        uint8_t getDirtyColMin(uint8_t y) const;
+        uint8_t getDirtyColMax(uint8_t y) const;
+
+        void markDirty();
+        void clearDirty();
+    #endif /* BOARD_TRACK_DIRTY */
+
+    static constexpr uint32_t sramBytes(uint8_t _width, uint8_t _height);
+    static constexpr uint16_t sramBlocks();
 };
 
 
 /**
- * Init Board Annex
+ * Heap a board allocates, the object itself not included
+ *
+ * @param  {uint8_t} _width
+ * @param  {uint8_t} _height
+ * @return {uint32_t}         bytes
+ */
+constexpr uint32_t Board::sramBytes(uint8_t _width, uint8_t _height) {
+    return (uint32_t)(_width / CELLS_PER_BYTE) * _height + (BOARD_TRACK_DIRTY ? 2 * (uint32_t)_height : 0);
+}
+
+/**
+ * Heap blocks a board allocates, the object itself not included
+ *
+ * @return {uint16_t} blocks
+ */
+constexpr uint16_t Board::sramBlocks() {
+    return 1 + (BOARD_TRACK_DIRTY ? 2 : 0);
+}
+
+
+/**
+ * Init Board, its cells in one block on the heap
  *
  * @param {uint8_t} width
  * @param {uint8_t} height
@@ -156,15 +278,80 @@ Board::Board(uint8_t _width, uint8_t _height) {
 
     num_columns = width / CELLS_PER_BYTE;
 
-    board = new uint8_t * [num_columns];
+    board = new uint8_t [(uint16_t)num_columns * height];
 
-    for (i_col_count = 0; i_col_count < num_columns; i_col_count++) {
-        board[i_col_count] = new uint8_t [height];
-        for (i_row = 0; i_row < height; i_row++) {
-            board[i_col_count][i_row] = NULL;
-            board[i_col_count][i_row] = CELL_STATE_DEAD;
-        }
-    }
+    #if (BOARD_TRACK_DIRTY)
+        dirty_col_min = new uint8_t [height];
+        dirty_col_max = new uint8_t [height];
+    #endif /* BOARD_TRACK_DIRTY */
+
+    owns_storage = true;
+
+    _initStorage();
+}
+
+/**
+ * Init Board in storage the caller keeps, e.g. static arrays, see
+ * BoardStatic.h
+ *
+ * @param {uint8_t}   width
+ * @param {uint8_t}   height
+ * @param {uint8_t *} _board          width / CELLS_PER_BYTE * height bytes
+ * @param {uint8_t *} _dirty_col_min  height bytes, NULL without
+ *                                    BOARD_TRACK_DIRTY
+ * @param {uint8_t *} _dirty_col_max  height bytes, NULL without
+ *                                    BOARD_TRACK_DIRTY
+ */
+Board::Board(
+    uint8_t _width,
+    uint8_t _height,
+    uint8_t * _board,
+    uint8_t * _dirty_col_min,
+    uint8_t * _dirty_col_max
+) {
+    width = _width;
+    height = _height;
+
+    num_columns = width / CELLS_PER_BYTE;
+
+    board = _board;
+
+    #if (BOARD_TRACK_DIRTY)
+        dirty_col_min = _dirty_col_min;
+        dirty_col_max = _dirty_col_max;
+    #else
+        (void)_dirty_col_min;
+        (void)_dirty_col_max;
+    #endif /* BOARD_TRACK_DIRTY */
+
+    owns_storage = false;
+
+    _initStorage();
+}
+
+/**
+ * Free the cells and dirty spans, unless the caller keeps them
+ */
+Board::~Board() {
+    if (!owns_storage) return;
+
+    delete [] board;
+
+    #if (BOARD_TRACK_DIRTY)
+        delete [] dirty_col_min;
+        delete [] dirty_col_max;
+    #endif /* BOARD_TRACK_DIRTY */
+}
+
+/**
+ * Set every cell dead and dirty
+ */
+void Board::_initStorage() {
+    memset(board, CELL_STATE_DEAD, (uint16_t)num_columns * height);
+
+    #if (BOARD_TRACK_DIRTY)
+        markDirty();
+    #endif /* BOARD_TRACK_DIRTY */
 }
 
 /**
@@ -192,25 +379,26 @@ uint8_t Board::getHeight() const {
  * @param  {uint8_t} y  y coordiante
  * @return {uint8_t}    state
  */
-uint8_t Board::getState(uint8_t x, uint8_t y) {
-    i_col_count = x / CELLS_PER_BYTE;
-    i_col = x % CELLS_PER_BYTE;
-    i_row = y;
+inline uint8_t Board::getState(uint8_t x, uint8_t y) {
+    uint8_t cell_state;
 
-    cell_state = CELL_STATE_DEAD;
+    #if (GAME_PROFILE)
+        game_profile.count(PROFILE_COUNTER_GET_STATE, 1);
+    #endif /* GAME_PROFILE */
 
-    for (i_cell_col = 0; i_cell_col < CELL_WIDTH; i_cell_col++) {
-        cell_col = i_col * CELL_WIDTH + i_cell_col;
-        i_cell_col_value = ((board[i_col_count][i_row] >> cell_col) & 1);
+    i_col = x % CELLS_PER_BYTE;
+    i_row = y;
 
-        cell_state = (cell_state | (i_cell_col_value << i_cell_col));
-    }
+    /**
+     * A cell's bits are next to each other, so take them all at once
+     */
+    cell_state = (board[(uint16_t)(x / CELLS_PER_BYTE) * height + i_row] >> (i_col * (CELL_WIDTH))) & CELL_STATE_MASK;
 
     #if (BOARD_DEBUG)
         if (cell_state != CELL_STATE_DEAD) {
             Serial.println("--------------");
             Serial.println("( " + String(x) + ", " + String(y) + " ) -> " + String(cell_state));
-            Serial.println("G: " + String(i_col_count));
+            Serial.println("G: " + String(x / CELLS_PER_BYTE));
             Serial.println("C: " + String(i_col));
             Serial.println("R: " + String(i_row));
             Serial.println("V: " + String(cell_state));
@@ -290,29 +478,42 @@ uint8_t Board::getState(uint8_t x, uint8_t y) {
  * @param  {uint8_t} y      y coordiante
  * @param  {uint8_t} state  state
  */
-void Board::setState(uint8_t x, uint8_t y, uint8_t state) {
-    i_col_count = x / CELLS_PER_BYTE;
+inline void Board::setState(uint8_t x, uint8_t y, uint8_t state) {
+    uint8_t * cell;
+
+    #if (BOARD_TRACK_DIRTY)
+        uint8_t byte_before;
+    #endif /* BOARD_TRACK_DIRTY */
+
+    #if (GAME_PROFILE)
+        game_profile.count(PROFILE_COUNTER_SET_STATE, 1);
+    #endif /* GAME_PROFILE */
+
     i_col = x % CELLS_PER_BYTE;
     i_row = y;
 
-    cell_state = CELL_STATE_DEAD;
-
-    if (state > CELL_STATE_ALIVE) { /* Avoid taking pow */
-        if (state > pow(2, (CELL_WIDTH)) - 1) {
-            #if (BOARD_DEBUG)
-                Serial.println("Warning, state is too high for CELL_WIDTH. Setting to max.");
-            #endif /* BOARD_DEBUG */
+    if (state > CELL_STATE_MASK) {
+        #if (BOARD_DEBUG)
+            Serial.println("Warning, state is too high for CELL_WIDTH. Setting to max.");
+        #endif /* BOARD_DEBUG */
 
-            state = pow(2, (CELL_WIDTH)) - 1;
-        }
+        state = CELL_STATE_MASK;
     }
 
-    for (i_cell_col = 0; i_cell_col < CELL_WIDTH; i_cell_col++) {
-        cell_state = (state >> i_cell_col) & 1;
-        cell_col = i_col * CELL_WIDTH + i_cell_col;
+    cell = board + (uint16_t)(x / CELLS_PER_BYTE) * height + i_row;
 
-        board[i_col_count][i_row] ^= (-cell_state ^ board[i_col_count][i_row]) & (1 << cell_col);
-    }
+    #if (BOARD_TRACK_DIRTY)
+        byte_before = *cell;
+    #endif /* BOARD_TRACK_DIRTY */
+
+    *cell = (*cell & ~(CELL_STATE_MASK << (i_col * (CELL_WIDTH)))) | (state << (i_col * (CELL_WIDTH)));
+
+    /**
+     * Only the cell's own bits can have changed
+     */
+    #if (BOARD_TRACK_DIRTY)
+        if (*cell != byte_before) _markDirty(x, y);
+    #endif /* BOARD_TRACK_DIRTY */
 
     return;
 }
@@ -323,7 +524,7 @@ void Board::setState(uint8_t x, uint8_t y, uint8_t state) {
  * @param  {uint8_t} x  x coordiante
  * @param  {uint8_t} y  y coordiante
  */
-void Board::setAlive(uint8_t x, uint8_t y) {
+inline void Board::setAlive(uint8_t x, uint8_t y) {
     setState(x, y, CELL_STATE_ALIVE);
 }
 
@@ -333,7 +534,7 @@ void Board::setAlive(uint8_t x, uint8_t y) {
  * @param  {uint8_t} x  x coordiante
  * @param  {uint8_t} y  y coordiante
  */
-void Board::setDead(uint8_t x, uint8_t y) {
+inline void Board::setDead(uint8_t x, uint8_t y) {
     setState(x, y, CELL_STATE_DEAD);
 }
 
@@ -341,19 +542,7 @@ void Board::setDead(uint8_t x, uint8_t y) {
  * Reset board
  */
 void Board::reset() {
-    for (i_col_count = 0; i_col_count < num_columns; i_col_count++) {
-        for (i_row = 0; i_row < height; i_row++) {
-            board[i_col_count][i_row] = NULL;
-        }
-    }
-
-    for (i_col_count = 0; i_col_count < num_columns; i_col_count++) {
-        for (i_col = 0; i_col < width; i_col++) {
-            for (i_row = 0; i_row < height; i_row++) {
-                board[i_col_count][i_row] = (board[i_col_count][i_row] | (CELL_STATE_DEAD << i_col));
-            }
-        }
-    }
+    _initStorage();
 }
 
 /**
@@ -369,28 +558,223 @@ void Board::copyBoard(Board * other_board) {
     }
 }
 
+/**
+ * FNV-1a of the cells as stored, so equal boards of the same size and cell
+ * width hash the same on every target
+ *
+ * @return {uint32_t} hash
+ */
+uint32_t Board::hash() const {
+    uint16_t num_bytes = (uint16_t)num_columns * height;
+    uint32_t hash = 2166136261UL;
+
+    for (uint16_t i_byte = 0; i_byte < num_bytes; i_byte++) {
+        hash = (hash ^ board[i_byte]) * 16777619UL;
+    }
+
+    return hash;
+}
+
+/**
+ * Random soup from the game's numbers at BOARD_RANDOM_DENSITY, see below
+ *
+ * @return {uint16_t} number of cells set alive
+ */
+uint16_t Board::randomize() {
+    return randomize(&game_random);
+}
+
+/**
+ * Random soup, every cell alive with a chance of `density` in 256 and dead
+ * otherwise. Drawn a byte of cells at a time, so no `getState` or `setState`
+ * per cell, and the whole board is dirty after.
+ *
+ * @param  {Random *} random    numbers to draw from
+ * @param  {uint8_t}  density   out of 256
+ * @param  {uint8_t}  symmetry  BOARD_SYMMETRY_*
+ * @return {uint16_t}           number of cells set alive
+ */
+uint16_t Board::randomize(Random * random, uint8_t density, uint8_t symmetry) {
+    uint8_t * cells = board;
+    uint16_t num_bytes = (uint16_t)num_columns * height;
+    uint16_t num_alive = 0;
+    uint32_t bits = 0;
+    uint8_t num_bits = 0;
 
-void Board::randomize() {
     #if (GAME_DEBUG)
         Serial.println("Resetting");
     #endif /* GAME_DEBUG */
 
-    randomSeed(analogRead(0));
-    randomSeed(analogRead(random(0, 5)));
+    for (uint16_t i_byte = 0; i_byte < num_bytes; i_byte++) {
+        if (num_bits < CELLS_PER_BYTE) {
+            bits = random->bits(density);
+            num_bits = 32;
+        }
 
-    num_skip = random(0, 1);
-    max_width_height = max(width, height);
+        cells[i_byte] = _spreadCells(bits);
 
-    for (i_col_annex = 0; i_col_annex < width; i_col_annex++) {
-        randomSeed(analogRead(random(0, 5)));
-        for (i_row_annex = 0; i_row_annex < height; i_row_annex++) {
-            num_skip = random(0, max_width_height);
-            if (i_col_annex % num_skip && num_skip % 2) {
-                setAlive(i_col_annex, i_row_annex);
-            }
+        bits >>= CELLS_PER_BYTE;
+        num_bits -= CELLS_PER_BYTE;
+    }
+
+    if (symmetry & BOARD_SYMMETRY_MIRROR_X) _mirrorX();
+    if (symmetry & BOARD_SYMMETRY_MIRROR_Y) _mirrorY();
+
+    /**
+     * A living cell is a single bit
+     */
+    for (uint16_t i_byte = 0; i_byte < num_bytes; i_byte++) num_alive += __builtin_popcount(cells[i_byte]);
+
+    #if (BOARD_TRACK_DIRTY)
+        markDirty();
+    #endif /* BOARD_TRACK_DIRTY */
+
+    return num_alive;
+}
+
+/**
+ * Low CELLS_PER_BYTE bits of `cells` as a byte of alive or dead cells
+ *
+ * @param  {uint8_t} cells  a bit a cell, lowest first
+ * @return {uint8_t}        byte of the board
+ */
+inline uint8_t Board::_spreadCells(uint8_t cells) {
+    uint8_t spread = 0;
+
+    for (uint8_t i_cell = 0; i_cell < CELLS_PER_BYTE; i_cell++) {
+        spread |= ((cells >> i_cell) & 1) << (i_cell * (CELL_WIDTH));
+    }
+
+    return spread;
+}
+
+/**
+ * Cells of a byte in the other order
+ *
+ * @param  {uint8_t} cells  byte of the board
+ * @return {uint8_t}        byte of the board
+ */
+uint8_t Board::_reverseCells(uint8_t cells) {
+    uint8_t reversed = 0;
+
+    for (uint8_t i_cell = 0; i_cell < CELLS_PER_BYTE; i_cell++) {
+        reversed |= ((cells >> (i_cell * (CELL_WIDTH))) & CELL_STATE_MASK) << ((CELLS_PER_BYTE - 1 - i_cell) * (CELL_WIDTH));
+    }
+
+    return reversed;
+}
+
+/**
+ * Make the right half the left half mirrored. Width is a whole number of
+ * bytes, so byte columns swap whole and only the cells in them reverse. The
+ * middle column of an odd number mirrors its own left half.
+ */
+void Board::_mirrorX() {
+    uint8_t * column;
+    uint8_t * column_mirror;
+    uint8_t mask_left = 0;
+
+    for (uint8_t i_cell = 0; i_cell < CELLS_PER_BYTE / 2; i_cell++) {
+        mask_left |= CELL_STATE_MASK << (i_cell * (CELL_WIDTH));
+    }
+
+    for (uint8_t i_column = 0; i_column < num_columns / 2; i_column++) {
+        column = board + (uint16_t)i_column * height;
+        column_mirror = board + (uint16_t)(num_columns - 1 - i_column) * height;
+
+        for (uint8_t y = 0; y < height; y++) column_mirror[y] = _reverseCells(column[y]);
+    }
+
+    if (num_columns % 2) {
+        column = board + (uint16_t)(num_columns / 2) * height;
+
+        for (uint8_t y = 0; y < height; y++) {
+            column[y] = (column[y] & mask_left) | (_reverseCells(column[y]) & ~mask_left);
         }
     }
 }
 
+/**
+ * Make the bottom half the top half mirrored
+ */
+void Board::_mirrorY() {
+    uint8_t * column;
+
+    for (uint8_t i_column = 0; i_column < num_columns; i_column++) {
+        column = board + (uint16_t)i_column * height;
+
+        for (uint8_t y = 0; y < height / 2; y++) column[height - 1 - y] = column[y];
+    }
+}
+
+
+#if (BOARD_TRACK_DIRTY)
+    /**
+     * Widen the dirty span of row `y` to cover `x`
+     *
+     * @param  {uint8_t} x  x coordiante
+     * @param  {uint8_t} y  y coordiante
+     */
+    inline void Board::_markDirty(uint8_t x, uint8_t y) {
+        if (x < dirty_col_min[y]) dirty_col_min[y] = x;
+        if (x > dirty_col_max[y]) dirty_col_max[y] = x;
+
+        any_dirty = true;
+    }
+
+    /**
+     * Any cell changed since the last `clearDirty`
+     *
+     * @return {bool} truth of any cell being dirty
+     */
+    bool Board::isDirty() const {
+        return any_dirty;
+    }
+
+    /**
+     * Get first dirty column of row `y`. Past `getDirtyColMax` if none.
+     *
+     * @param  {uint8_t} y  y coordiante
+     * @return {uint8_t}    column
+     */
+    uint8_t Board::getDirtyColMin(uint8_t y) const {
+        return dirty_col_min[y];
+    }
+
+    /**
+     * Get last dirty column of row `y`
+     *
+     * @param  {uint8_t} y  y coordiante
+     * @return {uint8_t}    column
+     */
+    uint8_t Board::getDirtyColMax(uint8_t y) const {
+        return dirty_col_max[y];
+    }
+
+    /**
+     * Mark every cell dirty, e.g. when what is shown no longer matches
+     */
+    void Board::markDirty() {
+        for (i_row = 0; i_row < height; i_row++) {
+            dirty_col_min[i_row] = 0;
+            dirty_col_max[i_row] = width - 1;
+        }
+
+        any_dirty = true;
+    }
+
+    /**
+     * Mark every cell clean, i.e. after drawing
+     */
+    void Board::clearDirty() {
+        for (i_row = 0; i_row < height; i_row++) {
+            dirty_col_min[i_row] = 0xFF;
+            dirty_col_max[i_row] = 0;
+        }
+
+        any_dirty = false;
+    }
+#endif /* BOARD_TRACK_DIRTY */
+
 
 #endif /* Board_h */
@@ -21,7 +21,7 @@
 
 /**
  * Check history so that we can reset if in a "stuck" state, i.e. the same board
- * for more than 1 move
+ * for more than 1 move. Default of `copyRow`, Conway passes its own.
  */
 #ifndef CONWAY_CHECK_HISTORY
     #define CONWAY_CHECK_HISTORY true
@@ -32,7 +32,7 @@
  *                                Board Annex                                  *
  *******************************************************************************/
 
-class BoardAnnex: public Board {
+class BoardAnnex: protected Board {
 private:
     uint8_t size_wise;
     bool width_wise;
@@ -40,12 +40,27 @@ private:
     uint8_t reader_i;
     bool i_writer;
 
-    #if (CONWAY_CHECK_HISTORY)
-        bool all_i_assigning_same;
-    #endif /* CONWAY_CHECK_HISTORY */
+    bool all_i_assigning_same;
+
+    void _init();
 
 public:
     BoardAnnex(uint8_t _width, uint8_t _height);
+    BoardAnnex(
+        uint8_t _width,
+        uint8_t _height,
+        uint8_t * _board,
+        uint8_t * _dirty_col_min,
+        uint8_t * _dirty_col_max
+    );
+
+    /**
+     * Board is a protected base, as the setters below hide its own. What
+     * reads the same is passed through.
+     */
+    using Board::getWidth;
+    using Board::getHeight;
+    using Board::getState;
 
     #if (GAME_DEBUG)
         void print();
@@ -57,11 +72,8 @@ public:
 
     void reset();
 
-    #if (CONWAY_CHECK_HISTORY)
-        bool copyRow(Board * other_board);
-    #else
-        void copyRow(Board * other_board);
-    #endif /* CONWAY_CHECK_HISTORY */
+    template <bool check_history = CONWAY_CHECK_HISTORY>
+    bool copyRow(Board * other_board);
 
     void finishRow();
 };
@@ -74,15 +86,39 @@ public:
  * @param {uint8_t} height
  */
 BoardAnnex::BoardAnnex(uint8_t _width, uint8_t _height): Board(_width, _height) {
-    size_wise = max(_width, _height);
-    width_wise = (_height <= _width);
+    _init();
+}
+
+/**
+ * Init Board Annex in storage the caller keeps, see Board
+ *
+ * @param {uint8_t}   width
+ * @param {uint8_t}   height
+ * @param {uint8_t *} _board
+ * @param {uint8_t *} _dirty_col_min
+ * @param {uint8_t *} _dirty_col_max
+ */
+BoardAnnex::BoardAnnex(
+    uint8_t _width,
+    uint8_t _height,
+    uint8_t * _board,
+    uint8_t * _dirty_col_min,
+    uint8_t * _dirty_col_max
+): Board(_width, _height, _board, _dirty_col_min, _dirty_col_max) {
+    _init();
+}
+
+/**
+ * Set up whichever way the board is stored
+ */
+void BoardAnnex::_init() {
+    size_wise = max(getWidth(), getHeight());
+    width_wise = (getHeight() <= getWidth());
 
     reader_i = 0;
     i_writer = false;
 
-    #if (CONWAY_CHECK_HISTORY)
-        all_i_assigning_same = true;
-    #endif /* CONWAY_CHECK_HISTORY */
+    all_i_assigning_same = true;
 }
 
 /**
@@ -107,7 +143,7 @@ BoardAnnex::BoardAnnex(uint8_t _width, uint8_t _height): Board(_width, _height)
  * @param  {uint8_t} y      y coordiante
  * @param  {uint8_t} state  state
  */
-void BoardAnnex::setState(uint8_t x, uint8_t y, uint8_t state) {
+inline void BoardAnnex::setState(uint8_t x, uint8_t y, uint8_t state) {
     if (width_wise) Board::setState(x, i_writer, state);
     else Board::setState(i_writer, y, state);
 }
@@ -118,7 +154,7 @@ void BoardAnnex::setState(uint8_t x, uint8_t y, uint8_t state) {
  * @param  {uint8_t} x  x coordiante
  * @param  {uint8_t} y  y coordiante
  */
-void BoardAnnex::setAlive(uint8_t x, uint8_t y) {
+inline void BoardAnnex::setAlive(uint8_t x, uint8_t y) {
     if (width_wise) Board::setAlive(x, i_writer);
     else Board::setAlive(i_writer, y);
 }
@@ -129,7 +165,7 @@ void BoardAnnex::setAlive(uint8_t x, uint8_t y) {
  * @param  {uint8_t} x  x coordiante
  * @param  {uint8_t} y  y coordiante
  */
-void BoardAnnex::setDead(uint8_t x, uint8_t y) {
+inline void BoardAnnex::setDead(uint8_t x, uint8_t y) {
     if (width_wise) Board::setDead(x, i_writer);
     else Board::setDead(i_writer, y);
 }
@@ -148,36 +184,27 @@ void BoardAnnex::reset() {
  * Copies over the row designated by `reader_i`. Returns truth of the rows
  * being the same
  *
- * @param  {Board *}        other_board     Board to copy over to
- * @return {bool or void}                   truth of the rows being the same if
- *                                          CONWAY_CHECK_HISTORY is true
+ * @param  {Board *} other_board    Board to copy over to
+ * @return {bool}                   truth of the rows being the same, always
+ *                                  true unless `check_history`
  */
-#if (CONWAY_CHECK_HISTORY)
-    bool BoardAnnex::copyRow(Board * other_board) {
-        all_i_assigning_same = true;
-
-        for (i_col_annex = 0; i_col_annex < size_wise; i_col_annex++) {
-            /**
-             * Check if row is same
-             */
-            if (all_i_assigning_same) all_i_assigning_same &= (other_board->getState(i_col_annex, reader_i) == getState(i_col_annex, !i_writer));
+template <bool check_history>
+bool BoardAnnex::copyRow(Board * other_board) {
+    all_i_assigning_same = true;
 
-            other_board->setState(i_col_annex, reader_i, getState(i_col_annex, !i_writer));
-        }
-
-        reader_i++;
+    for (i_col_annex = 0; i_col_annex < size_wise; i_col_annex++) {
+        /**
+         * Check if row is same
+         */
+        if (check_history && all_i_assigning_same) all_i_assigning_same &= (other_board->getState(i_col_annex, reader_i) == getState(i_col_annex, !i_writer));
 
-        return all_i_assigning_same;
+        other_board->setState(i_col_annex, reader_i, getState(i_col_annex, !i_writer));
     }
-#else
-    void BoardAnnex::copyRow(Board * other_board) {
-        for (i_col_annex = 0; i_col_annex < size_wise; i_col_annex++) {
-            other_board->setState(i_col_annex, reader_i, getState(i_col_annex, !i_writer));
-        }
 
-        reader_i++;
-    }
-#endif /* CONWAY_CHECK_HISTORY */
+    reader_i++;
+
+    return all_i_assigning_same;
+}
 
 /**
  * Reset reading row to NULL. Then set that row to be writable
@@ -21,7 +21,7 @@
 
 /**
  * Check history so that we can reset if in a "stuck" state, i.e. the same board
- * for more than 1 move
+ * for more than 1 move. Default of `copyRow`, Conway passes its own.
  */
 #ifndef CONWAY_CHECK_HISTORY
     #define CONWAY_CHECK_HISTORY true
@@ -37,19 +37,33 @@
  * represents stored final state of row back by 1, row 2 represents the temp
  * row to store current row's next state.
  */
-class BoardAnnexStack: public Board {
+class BoardAnnexStack: protected Board {
 private:
     uint8_t top_row_i_row;
     bool top_row_storing_annex;
 
     uint8_t i_row_in_memory;
 
-    #if (CONWAY_CHECK_HISTORY)
-        bool all_i_assigning_same;
-    #endif /* CONWAY_CHECK_HISTORY */
+    bool all_i_assigning_same;
+
+    void _init();
 
 public:
     BoardAnnexStack(uint8_t _width, uint8_t _height);
+    BoardAnnexStack(
+        uint8_t _width,
+        uint8_t _height,
+        uint8_t * _board,
+        uint8_t * _dirty_col_min,
+        uint8_t * _dirty_col_max
+    );
+
+    /**
+     * Board is a protected base, as the accessors below hide its own. What
+     * reads the same is passed through.
+     */
+    using Board::getWidth;
+    using Board::getHeight;
 
     uint8_t getState(uint8_t x, uint8_t y);
 
@@ -63,11 +77,8 @@ public:
 
     void reset();
 
-    #if (CONWAY_CHECK_HISTORY)
-        bool copyRow(Board * other_board);
-    #else
-        void copyRow(Board * other_board);
-    #endif /* CONWAY_CHECK_HISTORY */
+    template <bool check_history = CONWAY_CHECK_HISTORY>
+    bool copyRow(Board * other_board);
 
     void finishRow();
 };
@@ -80,12 +91,36 @@ public:
  * @param {uint8_t} height
  */
 BoardAnnexStack::BoardAnnexStack(uint8_t _width, uint8_t _height): Board(_width, _height) {
+    _init();
+}
+
+/**
+ * Init Board Annex Stack in storage the caller keeps, see Board
+ *
+ * @param {uint8_t}   width
+ * @param {uint8_t}   height
+ * @param {uint8_t *} _board
+ * @param {uint8_t *} _dirty_col_min
+ * @param {uint8_t *} _dirty_col_max
+ */
+BoardAnnexStack::BoardAnnexStack(
+    uint8_t _width,
+    uint8_t _height,
+    uint8_t * _board,
+    uint8_t * _dirty_col_min,
+    uint8_t * _dirty_col_max
+): Board(_width, _height, _board, _dirty_col_min, _dirty_col_max) {
+    _init();
+}
+
+/**
+ * Set up whichever way the board is stored
+ */
+void BoardAnnexStack::_init() {
     top_row_i_row = 0;
     i_row_in_memory = 0;
 
-    #if (CONWAY_CHECK_HISTORY)
-        all_i_assigning_same = true;
-    #endif /* CONWAY_CHECK_HISTORY */
+    all_i_assigning_same = true;
 }
 
 /**
@@ -95,7 +130,7 @@ BoardAnnexStack::BoardAnnexStack(uint8_t _width, uint8_t _height): Board(_width,
  * @param  {uint8_t} y  y coordiante
  * @return {uint8_t}    state
  */
-uint8_t BoardAnnexStack::getState(uint8_t x, uint8_t y) {
+inline uint8_t BoardAnnexStack::getState(uint8_t x, uint8_t y) {
     i_row_in_memory = y - top_row_i_row;
 
     return Board::getState(x, i_row_in_memory);
@@ -167,7 +202,7 @@ uint8_t BoardAnnexStack::getState(uint8_t x, uint8_t y) {
  * @param  {uint8_t} y      y coordiante
  * @param  {uint8_t} state  state
  */
-void BoardAnnexStack::setState(uint8_t x, uint8_t y, uint8_t state) {
+inline void BoardAnnexStack::setState(uint8_t x, uint8_t y, uint8_t state) {
     i_row_in_memory = y - top_row_i_row;
 
     // Serial.println("( " + String(x) + ", " + String(y) + ") => (" + String(x) + ", " + String(i_row_in_memory) + " )");
@@ -181,7 +216,7 @@ void BoardAnnexStack::setState(uint8_t x, uint8_t y, uint8_t state) {
  * @param  {uint8_t} x  x coordiante
  * @param  {uint8_t} y  y coordiante
  */
-void BoardAnnexStack::setAlive(uint8_t x, uint8_t y) {
+inline void BoardAnnexStack::setAlive(uint8_t x, uint8_t y) {
     i_row_in_memory = y - top_row_i_row;
 
     Board::setAlive(x, i_row_in_memory);
@@ -193,7 +228,7 @@ void BoardAnnexStack::setAlive(uint8_t x, uint8_t y) {
  * @param  {uint8_t} x  x coordiante
  * @param  {uint8_t} y  y coordiante
  */
-void BoardAnnexStack::setDead(uint8_t x, uint8_t y) {
+inline void BoardAnnexStack::setDead(uint8_t x, uint8_t y) {
     i_row_in_memory = y - top_row_i_row;
 
     Board::setDead(x, i_row_in_memory);
@@ -209,41 +244,32 @@ void BoardAnnexStack::reset() {
 }
 
 /**
- * Copies over the row designated by `reader_i`. Returns truth of the rows
+ * Copies over the top row, then shifts the stack up. Returns truth of the rows
  * being the same
  *
- * @param  {Board *}        other_board     Board to copy over to
- * @return {bool or void}                   truth of the rows being the same if
- *                                          CONWAY_CHECK_HISTORY is true
+ * @param  {Board *} other_board    Board to copy over to
+ * @return {bool}                   truth of the rows being the same, always
+ *                                  true unless `check_history`
  */
-#if (CONWAY_CHECK_HISTORY)
-    bool BoardAnnexStack::copyRow(Board * other_board) {
-        all_i_assigning_same = true;
-
-        for (uint8_t i_index = 0; i_index < other_board->getHeight(); i_index++) {
-            // Serial.println("cell " + String(i_col) + " = " + String(Board::getState(i_col, 0)));
+template <bool check_history>
+bool BoardAnnexStack::copyRow(Board * other_board) {
+    all_i_assigning_same = true;
 
-            /**
-             * Check if row is same
-             */
-            if (all_i_assigning_same) all_i_assigning_same &= (other_board->getState(i_index, top_row_i_row) == getState(i_index, top_row_i_row));
+    for (uint8_t i_index = 0; i_index < getWidth(); i_index++) {
+        // Serial.println("cell " + String(i_col) + " = " + String(Board::getState(i_col, 0)));
 
-            other_board->setState(i_index, top_row_i_row, getState(i_index, top_row_i_row));
-        }
+        /**
+         * Check if row is same
+         */
+        if (check_history && all_i_assigning_same) all_i_assigning_same &= (other_board->getState(i_index, top_row_i_row) == getState(i_index, top_row_i_row));
 
-        finishRow();
-
-        return all_i_assigning_same;
+        other_board->setState(i_index, top_row_i_row, getState(i_index, top_row_i_row));
     }
-#else
-    void BoardAnnexStack::copyRow(Board * other_board) {
-        for (uint8_t i_index = 0; i_index < other_board->getHeight(); i_index++) {
-            other_board->setState(i_index, top_row_i_row, getState(i_index, top_row_i_row));
-        }
 
-        finishRow();
-    }
-#endif /* CONWAY_CHECK_HISTORY */
+    finishRow();
+
+    return all_i_assigning_same;
+}
 
 /**
  * Shift memory up by 1. NULL out bottom row
@@ -0,0 +1,126 @@
+#ifndef BoardStatic_h
+#define BoardStatic_h
+
+/*******************************************************************************
+ *                                  Includes                                   *
+ *******************************************************************************/
+
+#include <Arduino.h>
+
+
+/*******************************************************************************
+ *                               Local Includes                                *
+ *******************************************************************************/
+
+#include "Board.h"
+
+
+/*******************************************************************************
+ *                             Board Static Storage                            *
+ *******************************************************************************/
+
+/**
+ * Cells of a `W` by `H` board laid out as Board keeps them. A base of
+ * BoardStatic rather than a member, so it is there before Board is.
+ */
+template <uint8_t W, uint8_t H>
+class BoardStaticStorage {
+protected:
+    uint8_t cells_static[W / CELLS_PER_BYTE][H];
+
+    #if (BOARD_TRACK_DIRTY)
+        uint8_t dirty_col_min_static[H];
+        uint8_t dirty_col_max_static[H];
+    #endif /* BOARD_TRACK_DIRTY */
+
+    static_assert(W % CELLS_PER_BYTE == 0, "Board width must be a multiple of CELLS_PER_BYTE");
+    static_assert(W > 0 && H > 0, "Board must have cells");
+};
+
+
+/*******************************************************************************
+ *                                Board Static                                 *
+ *******************************************************************************/
+
+/**
+ * Board of `W` by `H` cells, or BoardAnnex or BoardAnnexStack as `B`, in
+ * arrays of its own rather than on the heap. Size is fixed at compile time,
+ * so a global one takes no heap at all and `sizeof` is all of it.
+ */
+template <uint8_t W, uint8_t H, class B = Board>
+class BoardStatic : private BoardStaticStorage<W, H>, public B {
+public:
+    static const uint8_t width_static = W;
+    static const uint8_t height_static = H;
+
+    BoardStatic();
+};
+
+
+/**
+ * Init Board Static, every cell dead
+ */
+template <uint8_t W, uint8_t H, class B>
+BoardStatic<W, H, B>::BoardStatic(): B(
+    W,
+    H,
+    this->cells_static[0],
+
+    #if (BOARD_TRACK_DIRTY)
+        this->dirty_col_min_static,
+        this->dirty_col_max_static
+    #else
+        NULL,
+        NULL
+    #endif /* BOARD_TRACK_DIRTY */
+) { }
+
+
+/*******************************************************************************
+ *                            Board Static Optional                            *
+ *******************************************************************************/
+
+/**
+ * BoardStatic that is only there if `USE`, for a board a game can be set to do
+ * without, e.g. Conway's board two ago
+ */
+template <bool USE, uint8_t W, uint8_t H, class B = Board>
+class BoardStaticOptional {
+private:
+    BoardStatic<W, H, B> board_static;
+
+public:
+    B * get();
+};
+
+/**
+ * No board at all
+ */
+template <uint8_t W, uint8_t H, class B>
+class BoardStaticOptional<false, W, H, B> {
+public:
+    B * get();
+};
+
+
+/**
+ * The board
+ *
+ * @return {B *}
+ */
+template <bool USE, uint8_t W, uint8_t H, class B>
+B * BoardStaticOptional<USE, W, H, B>::get() {
+    return &board_static;
+}
+
+/**
+ * The board that is not there
+ *
+ * @return {B *}  NULL
+ */
+template <uint8_t W, uint8_t H, class B>
+B * BoardStaticOptional<false, W, H, B>::get() {
+    return NULL;
+}
+
+#endif /* BoardStatic_h */
@@ -82,55 +82,215 @@
 /**
  * Use density for positions. Requires more space, but will show colors
  * depending on how many cells are active around a given cell. Note will require
- * at least 2 bits for a given cell
+ * at least 2 bits for a given cell. The state is written by the step from the
+ * neighbor count it already has, so the first move of a round shows plain
+ * CELL_STATE_ALIVE.
  */
 #ifndef CONWAY_ASSIGN_DENSITY
     #define CONWAY_ASSIGN_DENSITY true
 #endif /* CONWAY_ASSIGN_DENSITY */
 
+/**
+ * Step the board with the bit packed kernel in ConwayPacked.h instead of cell
+ * by cell. Gives the same generations, but works on 64 bit words so it is only
+ * on by default off device. Replaces the checking boards, so the
+ * CONWAY_CHECKING_BOARD_* settings do not apply.
+ */
+#ifndef CONWAY_PACKED_KERNEL
+    #if defined(ARDUINO)
+        #define CONWAY_PACKED_KERNEL false
+    #else
+        #define CONWAY_PACKED_KERNEL true
+    #endif /* ARDUINO */
+#endif /* CONWAY_PACKED_KERNEL */
+
+/**
+ * Compile ConwayPacked.h in so a policy can pick the packed kernel. Its 64 bit
+ * words only make sense off device, so it is left out on the board unless
+ * CONWAY_PACKED_KERNEL asks for it.
+ */
+#ifndef CONWAY_PACKED_AVAILABLE
+    #if defined(ARDUINO)
+        #define CONWAY_PACKED_AVAILABLE CONWAY_PACKED_KERNEL
+    #else
+        #define CONWAY_PACKED_AVAILABLE true
+    #endif /* ARDUINO */
+#endif /* CONWAY_PACKED_AVAILABLE */
+
 /*******************************************************************************
  *                               Local Includes                                *
  *******************************************************************************/
 
+#include "Boards/BoardAnnex.h"
+#include "Boards/BoardAnnexStack.h"
+
+#if (CONWAY_PACKED_AVAILABLE)
+    #include "ConwayPacked.h"
+#endif /* CONWAY_PACKED_AVAILABLE */
+
+/**
+ * Board the next generation is worked out in by default
+ */
 #if (CONWAY_CHECKING_BOARD_MINIMIZE)
     #if (CONWAY_CHECKING_BOARD_USE_STACK)
-        #include "Boards/BoardAnnexStack.h"
+        typedef BoardAnnexStack ConwayBoardNext;
     #else
-        #include "Boards/BoardAnnex.h"
+        typedef BoardAnnex ConwayBoardNext;
     #endif /* CONWAY_CHECKING_BOARD_USE_STACK */
+#else
+    typedef Board ConwayBoardNext;
 #endif /* CONWAY_CHECKING_BOARD_MINIMIZE */
 
 
+/*******************************************************************************
+ *                             Conway Board Next                               *
+ *******************************************************************************/
+
+/**
+ * How Conway works the next generation out in a board of type `B`. A full
+ * Board is compared cell by cell and copied over once the step is done. Each
+ * step returns the truth of the rows it finished being the same as before.
+ */
+template <class B>
+struct ConwayBoardNextTraits {
+    static const bool minimized = false;
+
+    static constexpr uint8_t height(uint8_t board_height) {
+        return board_height;
+    }
+
+    template <bool check_history>
+    static bool finishRow(B *, Board *, uint8_t) {
+        return true;
+    }
+
+    template <bool check_history>
+    static bool finish(B *, Board *) {
+        return true;
+    }
+
+    static void copy(B * board_next, Board * board) {
+        board->copyBoard(board_next);
+    }
+};
+
+/**
+ * Two rows, the top is copied to the board once the row under it is done
+ */
+template <>
+struct ConwayBoardNextTraits<BoardAnnex> {
+    static const bool minimized = true;
+
+    static constexpr uint8_t height(uint8_t) {
+        return 2;
+    }
+
+    template <bool check_history>
+    static bool finishRow(BoardAnnex * board_next, Board * board, uint8_t i_row) {
+        bool row_same = true;
+
+        if (i_row > 0) row_same = board_next->copyRow<check_history>(board);
+
+        board_next->finishRow();
+
+        return row_same;
+    }
+
+    template <bool check_history>
+    static bool finish(BoardAnnex * board_next, Board * board) {
+        return board_next->copyRow<check_history>(board);
+    }
+
+    static void copy(BoardAnnex *, Board *) { }
+};
+
+/**
+ * Two rows kept as a stack, each row is copied once the one under it is done
+ * and the last one at the end
+ */
+template <>
+struct ConwayBoardNextTraits<BoardAnnexStack> {
+    static const bool minimized = true;
+
+    static constexpr uint8_t height(uint8_t) {
+        return 2;
+    }
+
+    template <bool check_history>
+    static bool finishRow(BoardAnnexStack * board_next, Board * board, uint8_t i_row) {
+        if (i_row > 0) return board_next->copyRow<check_history>(board);
+
+        return true;
+    }
+
+    template <bool check_history>
+    static bool finish(BoardAnnexStack * board_next, Board * board) {
+        return board_next->copyRow<check_history>(board);
+    }
+
+    static void copy(BoardAnnexStack *, Board *) { }
+};
+
+
+/*******************************************************************************
+ *                               Conway Policy                                 *
+ *******************************************************************************/
+
+/**
+ * Settings of a Conway as template parameters, so differently set games can be
+ * built side by side, e.g. in the benchmark. Each defaults to its setting
+ * above, which is still how the sketch sets its game.
+ *
+ *   B        board the next generation is worked out in, see ConwayBoardNext
+ *   PACKED   CONWAY_PACKED_KERNEL
+ *   HISTORY  CONWAY_CHECK_HISTORY
+ *   CYCLE    CONWAY_CHECK_IF_IN_CYCLE
+ *   DENSITY  CONWAY_ASSIGN_DENSITY
+ */
+template <
+    class B = ConwayBoardNext,
+    bool PACKED = CONWAY_PACKED_KERNEL,
+    bool HISTORY = CONWAY_CHECK_HISTORY,
+    bool CYCLE = CONWAY_CHECK_IF_IN_CYCLE,
+    bool DENSITY = CONWAY_ASSIGN_DENSITY
+>
+struct ConwayPolicy {
+    typedef B BoardNext;
+
+    static const bool packed_kernel = PACKED;
+    static const bool check_history = HISTORY;
+    static const bool check_if_in_cycle = CYCLE;
+    static const bool assign_density = DENSITY;
+
+    static_assert(!PACKED || CONWAY_PACKED_AVAILABLE, "Packed kernel is not compiled in, see CONWAY_PACKED_AVAILABLE");
+    static_assert(!CYCLE || GAME_COUNT_MOVES, "Checking for cycles needs GAME_COUNT_MOVES");
+    static_assert(!DENSITY || (CELL_WIDTH) >= 2, "Density needs at least 2 bits a cell");
+};
+
+
 /*******************************************************************************
  *                                   Conway                                    *
  *******************************************************************************/
 
-class Conway: public Game {
+template <class P = ConwayPolicy<> >
+class ConwayT: public Game {
 private:
+    typedef typename P::BoardNext BoardNext;
+    typedef ConwayBoardNextTraits<BoardNext> BoardNextTraits;
 
-    #if (CONWAY_CHECKING_BOARD_MINIMIZE)
-        #if (CONWAY_CHECKING_BOARD_USE_STACK)
-            BoardAnnexStack * board_next;
-        #else
-            BoardAnnex * board_next;
-        #endif /* CONWAY_CHECKING_BOARD_USE_STACK */
-    #else
-        Board * board_next;
-    #endif /* CONWAY_CHECKING_BOARD_MINIMIZE */
+    #if (CONWAY_PACKED_AVAILABLE)
+        ConwayPacked * board_packed;
+    #endif /* CONWAY_PACKED_AVAILABLE */
 
-    #if (CONWAY_CHECK_IF_IN_CYCLE)
-        Board * board_two_ago;
-    #endif /* CONWAY_CHECK_IF_IN_CYCLE */
+    BoardNext * board_next;
+    Board * board_two_ago;
 
     #if (CONWAY_CYCLE_DETECTED_BUFFER > 0)
         uint8_t number_of_moves_since_cycle_detected;
     #endif /* CONWAY_CYCLE_DETECTED_BUFFER */
 
     bool any_cells_alive;
-
-    #if (CONWAY_CHECK_HISTORY)
-        bool board_same;
-    #endif /* CONWAY_CHECK_HISTORY */
+    bool board_same;
 
     uint8_t num_cells_active_surrounding;
 
@@ -149,25 +309,119 @@ private:
     void _assignPattern();
     void _assignNumberCellsActiveSurrounding(uint8_t x, uint8_t y);
 
-    #if (CONWAY_ASSIGN_DENSITY)
-        void _assignCurrentDensity();
-    #endif /* CONWAY_ASSIGN_DENSITY */
+    #if (CONWAY_PACKED_AVAILABLE)
+        void _updatePacked();
+    #endif /* CONWAY_PACKED_AVAILABLE */
+
+    void _updateCells();
+
+    void _init();
+
+    static constexpr SramUsage _sram(SramUsage usage);
+    static constexpr SramUsage _sramCells(SramUsage usage);
 
 protected:
     virtual void _newRound();
 
+    ConwayT(
+        uint8_t num_pixels_width,
+        uint8_t num_pixels_height,
+        uint8_t num_boards_x,
+        uint8_t num_boards_y,
+        const GameStorage & storage,
+        BoardNext * _board_next,
+        Board * _board_two_ago
+    );
+
 public:
-    Conway(
+    ConwayT(
         uint8_t num_pixels_width,
         uint8_t num_pixels_height,
         uint8_t num_boards_x,
         uint8_t num_boards_y,
         uint8_t pin
     );
+    virtual ~ConwayT();
 
     virtual void update();
+
+    virtual const char * getName() const;
+    virtual uint32_t getConfig() const;
+
+    static constexpr SramUsage sram(
+        uint8_t num_pixels_width,
+        uint8_t num_pixels_height,
+        uint8_t num_boards_x,
+        uint8_t num_boards_y
+    );
 };
 
+/**
+ * Conway set by the settings above
+ */
+typedef ConwayT<> Conway;
+
+
+/**
+ * SRAM of Conway on a panel that size, see Game::sram. Adds the packed board
+ * or the checking boards.
+ *
+ * @param  {uint8_t} num_pixels_width   Width of individual NeoMatrix
+ * @param  {uint8_t} num_pixels_height  Height of individual NeoMatrix
+ * @param  {uint8_t} num_boards_x       Number of boards in X direction
+ * @param  {uint8_t} num_boards_y       Number of boards in Y direction
+ * @return {SramUsage}
+ */
+template <class P>
+constexpr SramUsage ConwayT<P>::sram(
+    uint8_t num_pixels_width,
+    uint8_t num_pixels_height,
+    uint8_t num_boards_x,
+    uint8_t num_boards_y
+) {
+    return _sram(Game::sram(num_pixels_width, num_pixels_height, num_boards_x, num_boards_y));
+}
+
+/**
+ * Add what Conway allocates to the game's SRAM
+ *
+ * @param  {SramUsage} usage  of Game
+ * @return {SramUsage}
+ */
+template <class P>
+constexpr SramUsage ConwayT<P>::_sram(SramUsage usage) {
+    #if (CONWAY_PACKED_AVAILABLE)
+        return P::packed_kernel
+            ? usage.withGame(
+                sizeof(ConwayT),
+                sizeof(ConwayPacked) + ConwayPacked::sramBytes(usage.width, usage.height, P::check_if_in_cycle),
+                1 + ConwayPacked::sramBlocks(P::check_if_in_cycle)
+            )
+            : _sramCells(usage);
+    #else
+        return _sramCells(usage);
+    #endif /* CONWAY_PACKED_AVAILABLE */
+}
+
+/**
+ * Add the checking boards to the game's SRAM
+ *
+ * @param  {SramUsage} usage  of Game
+ * @return {SramUsage}
+ */
+template <class P>
+constexpr SramUsage ConwayT<P>::_sramCells(SramUsage usage) {
+    return usage.withGame(
+        sizeof(ConwayT),
+
+        sizeof(BoardNext) + Board::sramBytes(usage.width, BoardNextTraits::height(usage.height))
+        + (P::check_if_in_cycle ? sizeof(Board) + Board::sramBytes(usage.width, usage.height) : 0),
+
+        1 + Board::sramBlocks()
+        + (P::check_if_in_cycle ? 1 + Board::sramBlocks() : 0)
+    );
+}
+
 
 /**
  * Constructor
@@ -178,7 +432,8 @@ public:
  * @param  {uint8_t} num_boards_y       Number of boards in Y direction
  * @param  {uint8_t} pin                Pin out on Arduino
  */
-Conway::Conway(
+template <class P>
+ConwayT<P>::ConwayT(
     uint8_t num_pixels_width,
     uint8_t num_pixels_height,
     uint8_t num_boards_x,
@@ -191,72 +446,139 @@ Conway::Conway(
     num_boards_y,
     pin
 ) {
+    board_next = NULL;
+    board_two_ago = NULL;
+
+    if (P::packed_kernel) {
+        #if (CONWAY_PACKED_AVAILABLE)
+            board_packed = new ConwayPacked(width, height, P::assign_density, P::check_if_in_cycle);
+        #endif /* CONWAY_PACKED_AVAILABLE */
+    } else {
+        #if (CONWAY_PACKED_AVAILABLE)
+            board_packed = NULL;
+        #endif /* CONWAY_PACKED_AVAILABLE */
+
+        board_next = new BoardNext(width, BoardNextTraits::height(height));
+
+        if (P::check_if_in_cycle) board_two_ago = new Board(width, height);
+    }
+
+    _init();
+}
+
+/**
+ * Constructor for a game in storage the caller keeps, see Game. The packed
+ * kernel, host only, still allocates its own words.
+ *
+ * @param  {uint8_t}             num_pixels_width   Width of individual NeoMatrix
+ * @param  {uint8_t}             num_pixels_height  Height of individual NeoMatrix
+ * @param  {uint8_t}             num_boards_x       Number of boards in X direction
+ * @param  {uint8_t}             num_boards_y       Number of boards in Y direction
+ * @param  {const GameStorage &} storage
+ * @param  {BoardNext *}         _board_next        width by
+ *                                                  BoardNextTraits::height, NULL
+ *                                                  with the packed kernel
+ * @param  {Board *}             _board_two_ago     same size as the board,
+ *                                                  NULL if not checking for
+ *                                                  cycles
+ */
+template <class P>
+ConwayT<P>::ConwayT(
+    uint8_t num_pixels_width,
+    uint8_t num_pixels_height,
+    uint8_t num_boards_x,
+    uint8_t num_boards_y,
+    const GameStorage & storage,
+    BoardNext * _board_next,
+    Board * _board_two_ago
+): Game(
+    num_pixels_width,
+    num_pixels_height,
+    num_boards_x,
+    num_boards_y,
+    storage
+) {
+    #if (CONWAY_PACKED_AVAILABLE)
+        board_packed = P::packed_kernel
+            ? new ConwayPacked(width, height, P::assign_density, P::check_if_in_cycle)
+            : NULL;
+    #endif /* CONWAY_PACKED_AVAILABLE */
+
+    board_next = _board_next;
+    board_two_ago = _board_two_ago;
+
+    _init();
+}
+
+/**
+ * Free the boards the game allocated, leaving those the caller keeps
+ */
+template <class P>
+ConwayT<P>::~ConwayT() {
+    #if (CONWAY_PACKED_AVAILABLE)
+        delete board_packed;
+    #endif /* CONWAY_PACKED_AVAILABLE */
+
+    if (!owns_storage) return;
+
+    delete board_next;
+    delete board_two_ago;
+}
+
+/**
+ * Set up whichever way the boards are kept
+ */
+template <class P>
+void ConwayT<P>::_init() {
     #if (CONWAY_CYCLE_DETECTED_BUFFER > 0)
         number_of_moves_since_cycle_detected = 0;
     #endif /* CONWAY_CYCLE_DETECTED_BUFFER */
 
     any_cells_alive = false;
-
-    #if (CONWAY_CHECKING_BOARD_MINIMIZE)
-        #if (CONWAY_CHECKING_BOARD_USE_STACK)
-            board_next = new BoardAnnexStack(width, 2);
-        #else
-            board_next = new BoardAnnex(width, 2);
-        #endif /* CONWAY_CHECKING_BOARD_USE_STACK */
-    #else
-        board_next = new Board(width, height);
-    #endif /* CONWAY_CHECKING_BOARD_MINIMIZE */
-
-    #if (CONWAY_CHECK_IF_IN_CYCLE)
-        board_two_ago =  new Board(width, height);
-    #endif /* CONWAY_CHECK_IF_IN_CYCLE */
+    board_same = false;
 }
 
 /**
  * Inits colors for grid. If CONWAY_ASSIGN_MONOCHROME is false then randomly
  * choose a color scheme.
  */
-void Conway::_initColors() {
+template <class P>
+void ConwayT<P>::_initColors() {
 
     #if (CONWAY_ASSIGN_MONOCHROME)
-        colors[CELL_STATE_ALIVE]                = led_matrix->Color(255, 255, 255);
+        colors[CELL_STATE_ALIVE]                = Adafruit_NeoPixel::Color(255, 255, 255);
 
-        #if (CONWAY_ASSIGN_DENSITY)
-            colors[CELL_STATE_ALIVE_LOW]        = led_matrix->Color(150, 150, 150);
-            colors[CELL_STATE_ALIVE_HIGH]       = led_matrix->Color(255, 255, 255);
-        #endif /* CONWAY_ASSIGN_DENSITY */
+        if (P::assign_density) {
+            colors[CELL_STATE_ALIVE_LOW]        = Adafruit_NeoPixel::Color(150, 150, 150);
+            colors[CELL_STATE_ALIVE_HIGH]       = Adafruit_NeoPixel::Color(255, 255, 255);
+        }
     #else
         /**
          * Compute a random color
          */
-        // TODO minimize, but get more random
-        randomSeed(analogRead(0));
-        randomSeed(analogRead(random(0, 5)));
-        randomSeed(analogRead(num_skip)); // maybe this should be moved up one line?
-
-        num_skip = random(0, 3);
+        num_skip = game_random.below(3);
 
         if (num_skip == 0) {
-            colors[CELL_STATE_ALIVE]            = led_matrix->Color(255, 200, 0);
+            colors[CELL_STATE_ALIVE]            = Adafruit_NeoPixel::Color(255, 200, 0);
 
-            #if (CONWAY_ASSIGN_DENSITY)
-                colors[CELL_STATE_ALIVE_LOW]    = led_matrix->Color(200, 50, 0);
-                colors[CELL_STATE_ALIVE_HIGH]   = led_matrix->Color(255, 200, 0);
-            #endif /* CONWAY_ASSIGN_DENSITY */
+            if (P::assign_density) {
+                colors[CELL_STATE_ALIVE_LOW]    = Adafruit_NeoPixel::Color(200, 50, 0);
+                colors[CELL_STATE_ALIVE_HIGH]   = Adafruit_NeoPixel::Color(255, 200, 0);
+            }
         } else if (num_skip == 1) {
-            colors[CELL_STATE_ALIVE]            = led_matrix->Color(0, 255, 0);
+            colors[CELL_STATE_ALIVE]            = Adafruit_NeoPixel::Color(0, 255, 0);
 
-            #if (CONWAY_ASSIGN_DENSITY)
-                colors[CELL_STATE_ALIVE_LOW]    = led_matrix->Color(0, 200, 50);
-                colors[CELL_STATE_ALIVE_HIGH]   = led_matrix->Color(0, 255, 0);
-            #endif /* CONWAY_ASSIGN_DENSITY */
+            if (P::assign_density) {
+                colors[CELL_STATE_ALIVE_LOW]    = Adafruit_NeoPixel::Color(0, 200, 50);
+                colors[CELL_STATE_ALIVE_HIGH]   = Adafruit_NeoPixel::Color(0, 255, 0);
+            }
         } else if (num_skip == 2) {
-            colors[CELL_STATE_ALIVE]            = led_matrix->Color(0, 0, 255);
+            colors[CELL_STATE_ALIVE]            = Adafruit_NeoPixel::Color(0, 0, 255);
 
-            #if (CONWAY_ASSIGN_DENSITY)
-                colors[CELL_STATE_ALIVE_LOW]    = led_matrix->Color(50, 0, 200);
-                colors[CELL_STATE_ALIVE_HIGH]   = led_matrix->Color(0, 0, 255);
-            #endif /* CONWAY_ASSIGN_DENSITY */
+            if (P::assign_density) {
+                colors[CELL_STATE_ALIVE_LOW]    = Adafruit_NeoPixel::Color(50, 0, 200);
+                colors[CELL_STATE_ALIVE_HIGH]   = Adafruit_NeoPixel::Color(0, 0, 255);
+            }
         } else {
 
             #if (GAME_DEBUG)
@@ -266,20 +588,23 @@ void Conway::_initColors() {
         }
     #endif /* CONWAY_ASSIGN_MONOCHROME */
 
-    // colors[CELL_STATE_ALIVE_LOW]    = led_matrix->Color(255, 255, 255);
-    // colors[CELL_STATE_ALIVE_HIGH]   = led_matrix->Color(255, 255, 255);
-    // colors[CELL_STATE_WIPE]         = led_matrix->Color(255, 255, 255);
-    // colors[CELL_STATE_ALIVE_LOW]    = led_matrix->Color(200, 50, 0);
-    // colors[CELL_STATE_ALIVE_HIGH]   = led_matrix->Color(255, 200, 0);
-    // colors[CELL_STATE_WIPE]         = led_matrix->Color(255, 255, 0);
+    // colors[CELL_STATE_ALIVE_LOW]    = Adafruit_NeoPixel::Color(255, 255, 255);
+    // colors[CELL_STATE_ALIVE_HIGH]   = Adafruit_NeoPixel::Color(255, 255, 255);
+    // colors[CELL_STATE_WIPE]         = Adafruit_NeoPixel::Color(255, 255, 255);
+    // colors[CELL_STATE_ALIVE_LOW]    = Adafruit_NeoPixel::Color(200, 50, 0);
+    // colors[CELL_STATE_ALIVE_HIGH]   = Adafruit_NeoPixel::Color(255, 200, 0);
+    // colors[CELL_STATE_WIPE]         = Adafruit_NeoPixel::Color(255, 255, 0);
 
     // return;
+
+    _updatePalette();
 }
 
 /**
  * Assign pattern to grid
  */
-void Conway::_assignPattern() {
+template <class P>
+void ConwayT<P>::_assignPattern() {
 
     // board->setAlive(1, 0);
     // board->setAlive(1, 1);
@@ -338,7 +663,8 @@ void Conway::_assignPattern() {
  * @param  {uint8_t} x  x coordiante
  * @param  {uint8_t} y  y coordiante
  */
-void Conway::_assignNumberCellsActiveSurrounding(uint8_t x, uint8_t y) {
+template <class P>
+void ConwayT<P>::_assignNumberCellsActiveSurrounding(uint8_t x, uint8_t y) {
     num_cells_active_surrounding = 0;
     bound_col_min = x;
     bound_col_max = x;
@@ -376,31 +702,11 @@ void Conway::_assignNumberCellsActiveSurrounding(uint8_t x, uint8_t y) {
     }
 }
 
-/**
- * Assigns and sets the density for a grid. Intended to be used only after
- * `_randomize()` is called. Only is enabled if CONWAY_ASSIGN_DENSITY is true
- */
-#if (CONWAY_ASSIGN_DENSITY)
-    void Conway::_assignCurrentDensity() {
-        /**
-         * Update state
-         */
-        for (i_col = 0; i_col < width; i_col++) {
-            for (i_row = 0; i_row < height; i_row++) {
-                if (board->getState(i_col, i_row) >= CELL_STATE_ALIVE) {
-                    _assignNumberCellsActiveSurrounding(i_col, i_row);
-
-                    board->setState(i_col, i_row, num_cells_active_surrounding + CELL_STATE_ALIVE_LOW);
-                }
-            }
-        }
-    }
-#endif /* CONWAY_ASSIGN_DENSITY */
-
 /**
  * Begin a new round of conway. Reset grid and init colors.
  */
-void Conway::_newRound() {
+template <class P>
+void ConwayT<P>::_newRound() {
     Game::_newRound();
 
     #if (CONWAY_CYCLE_DETECTED_BUFFER > 0)
@@ -408,21 +714,51 @@ void Conway::_newRound() {
     #endif  /* CONWAY_CYCLE_DETECTED_BUFFER */
 
     // _assignPattern();
-    board->randomize();
+    stats.population = board->randomize();
     any_cells_alive = true;
 
-    #if (CONWAY_ASSIGN_DENSITY)
-        _assignCurrentDensity();
-    #endif /* CONWAY_ASSIGN_DENSITY */
+    #if (CONWAY_PACKED_AVAILABLE)
+        if (P::packed_kernel) board_packed->copyFromBoard(board);
+    #endif /* CONWAY_PACKED_AVAILABLE */
 
     _initColors();
 }
 
+/**
+ * Get the name of the game, as recorded
+ *
+ * @return {const char *} name
+ */
+template <class P>
+const char * ConwayT<P>::getName() const {
+    return "conway";
+}
+
+/**
+ * Get a hash of the settings, see Game::getConfig. The board the next
+ * generation is worked out in and the packed kernel are left out, every one
+ * plays a seed the same.
+ *
+ * @return {uint32_t} config
+ */
+template <class P>
+uint32_t ConwayT<P>::getConfig() const {
+    uint32_t config = Game::getConfig();
+
+    config = _configMix(config, P::check_history);
+    config = _configMix(config, P::check_if_in_cycle);
+    config = _configMix(config, P::assign_density);
+    config = _configMix(config, CONWAY_CYCLE_DETECTED_BUFFER);
+
+    return config;
+}
+
 /**
  * Update grid and do necessary checks. If no cells alive, create a new round.
  * Optional checking is enabled with CONWAY_CHECK_HISTORY
  */
-void Conway::update() {
+template <class P>
+void ConwayT<P>::update() {
 
     /**
      * Check if anything on board
@@ -436,13 +772,76 @@ void Conway::update() {
         return;
     }
 
-    #if (CONWAY_CHECK_IF_IN_CYCLE)
-        if (number_of_rounds_running % 2) {
-            board_two_ago->reset();
+    #if (CONWAY_PACKED_AVAILABLE)
+        if (P::packed_kernel) {
+            _updatePacked();
+            return;
+        }
+    #endif /* CONWAY_PACKED_AVAILABLE */
+
+    _updateCells();
+}
+
+#if (CONWAY_PACKED_AVAILABLE)
+    /**
+     * Step the packed board and write the changed cells back to `board`. Same
+     * checks as `_updateCells`, done on the packed words.
+     */
+    template <class P>
+    void ConwayT<P>::_updatePacked() {
+        if (P::check_if_in_cycle && number_of_rounds_running % 2) board_packed->storeTwoAgo();
+
+        board_packed->step();
+        any_cells_alive = board_packed->anyAlive();
+
+        #if (GAME_PROFILE)
+            game_profile.count(PROFILE_COUNTER_CELLS, (uint16_t)width * height);
+        #endif /* GAME_PROFILE */
+
+        stats.generation++;
+        stats.population = board_packed->getPopulation();
+        stats.births = board_packed->getBirths();
+        stats.deaths = board_packed->getDeaths();
+
+        board_same = !board_packed->copyToBoard(board);
+
+        if (P::check_history && board_same) {
+            #if (GAME_DEBUG)
+                Serial.println("Board Stuck in same state");
+            #endif /* GAME_DEBUG */
 
-            board_two_ago->copyBoard(board);
+            _newRound();
+            return;
         }
-    #endif /* CONWAY_CHECK_IF_IN_CYCLE */
+
+        if (P::check_if_in_cycle && !(number_of_rounds_running % 2) && board_packed->sameAsTwoAgo()) {
+            #if (GAME_DEBUG)
+                Serial.println("Board Stuck in cycle");
+            #endif /* GAME_DEBUG */
+
+            #if (CONWAY_CYCLE_DETECTED_BUFFER > 0)
+                number_of_moves_since_cycle_detected++;
+
+                if (number_of_moves_since_cycle_detected >= CONWAY_CYCLE_DETECTED_BUFFER) _newRound();
+
+                return;
+            #endif /* CONWAY_CYCLE_DETECTED_BUFFER */
+
+            _newRound();
+        }
+    }
+#endif /* CONWAY_PACKED_AVAILABLE */
+
+/**
+ * Step the board cell by cell, using `board_next` to hold the next state
+ */
+template <class P>
+void ConwayT<P>::_updateCells() {
+    if (P::check_if_in_cycle && number_of_rounds_running % 2) {
+        board_two_ago->reset();
+
+        board_two_ago->copyBoard(board);
+    }
 
     /**
      * Reset board next
@@ -450,9 +849,16 @@ void Conway::update() {
     board_next->reset();
     any_cells_alive = false;
 
-    #if (CONWAY_CHECK_HISTORY)
-        board_same = true;
-    #endif /* CONWAY_CHECK_HISTORY */
+    stats.generation++;
+    stats.population = 0;
+    stats.births = 0;
+    stats.deaths = 0;
+
+    board_same = true;
+
+    #if (GAME_PROFILE)
+        game_profile.count(PROFILE_COUNTER_CELLS, (uint16_t)width * height);
+    #endif /* GAME_PROFILE */
 
     /**
      * Compute what is alive in the next round
@@ -467,36 +873,32 @@ void Conway::update() {
             if (board->getState(i_col, i_row) >= CELL_STATE_ALIVE) {
                 if (num_cells_active_surrounding == 2 || num_cells_active_surrounding == 3) {
 
-                    #if (CONWAY_ASSIGN_DENSITY)
-                        board_next->setState(i_col, i_row, num_cells_active_surrounding);
-                    #else
-                        board_next->setAlive(i_col, i_row);
-                    #endif /* CONWAY_ASSIGN_DENSITY */
+                    if (P::assign_density) board_next->setState(i_col, i_row, num_cells_active_surrounding);
+                    else board_next->setAlive(i_col, i_row);
 
                     // Serial.println("Alive: " + String(i_col) + " , " + String(i_row));
 
                     any_cells_alive = true;
+                    stats.population++;
                 }
+                else stats.deaths++;
             }
             else if (num_cells_active_surrounding == 3) {
-                #if (CONWAY_ASSIGN_DENSITY)
-                    board_next->setState(i_col, i_row, num_cells_active_surrounding);
-                #else
-                    board_next->setAlive(i_col, i_row);
-                #endif /* CONWAY_ASSIGN_DENSITY */
+                if (P::assign_density) board_next->setState(i_col, i_row, num_cells_active_surrounding);
+                else board_next->setAlive(i_col, i_row);
 
                 // Serial.println("Alive: " + String(i_col) + " , " + String(i_row));
 
                 any_cells_alive = true;
+                stats.population++;
+                stats.births++;
             }
 
-            #if (CONWAY_CHECK_HISTORY)
-                #if (!CONWAY_CHECKING_BOARD_MINIMIZE)
-                    if(!board_same) continue;
+            if (P::check_history && !BoardNextTraits::minimized) {
+                if(!board_same) continue;
 
-                    if (board->getState(i_col, i_row) != board_next->getState(i_col, i_row)) board_same = false;
-                #endif /* !CONWAY_CHECKING_BOARD_MINIMIZE */
-            #endif /* CONWAY_CHECK_HISTORY */
+                if (board->getState(i_col, i_row) != board_next->getState(i_col, i_row)) board_same = false;
+            }
         }
 
         /**
@@ -504,96 +906,64 @@ void Conway::update() {
          * Check to see if top row is the same. Clear top, assign bottom to top,
          * then clear bottom.
          */
-        #if (CONWAY_CHECKING_BOARD_MINIMIZE)
-            #if (CONWAY_CHECK_HISTORY)
-                if(i_row > 0) board_same &= board_next->copyRow(board);
-            #else
-                if(i_row > 0) board_next->copyRow(board);
-            #endif /* CONWAY_CHECK_HISTORY */
-
-            #if (!CONWAY_CHECKING_BOARD_USE_STACK)
-                board_next->finishRow();
-            #endif /* CONWAY_CHECKING_BOARD_USE_STACK */
-        #endif /* CONWAY_CHECKING_BOARD_MINIMIZE */
+        board_same &= BoardNextTraits::template finishRow<P::check_history>(board_next, board, i_row);
     }
 
-    #if (CONWAY_CHECKING_BOARD_MINIMIZE)
-        #if (CONWAY_CHECK_HISTORY)
-            board_same &= board_next->copyRow(board);
+    board_same &= BoardNextTraits::template finish<P::check_history>(board_next, board);
 
-            #if (CONWAY_CHECKING_BOARD_USE_STACK)
-                board_same &= board_next->copyRow(board);
-            #endif /* CONWAY_CHECKING_BOARD_USE_STACK */
-        #else
-            board_next->copyRow(board);
-
-            #if (CONWAY_CHECKING_BOARD_USE_STACK)
-                board_next->copyRow(board);
-            #endif /* CONWAY_CHECKING_BOARD_USE_STACK */
-        #endif /* CONWAY_CHECK_HISTORY */
-    #endif /* CONWAY_CHECKING_BOARD_MINIMIZE */
-
-    #if (CONWAY_CHECK_HISTORY)
-        if (board_same) {
-            #if (GAME_DEBUG)
-                Serial.println("Board Stuck in same state");
-            #endif /* GAME_DEBUG */
+    if (P::check_history && board_same) {
+        #if (GAME_DEBUG)
+            Serial.println("Board Stuck in same state");
+        #endif /* GAME_DEBUG */
 
-            _newRound();
-            return;
-        }
-    #endif /* CONWAY_CHECK_HISTORY*/
+        _newRound();
+        return;
+    }
 
-    #if (!CONWAY_CHECKING_BOARD_MINIMIZE)
-        board->copyBoard(board_next);
-    #endif /* !CONWAY_CHECKING_BOARD_MINIMIZE */
+    BoardNextTraits::copy(board_next, board);
 
-    #if (CONWAY_CHECK_IF_IN_CYCLE)
-        if (!(number_of_rounds_running % 2)) {
+    if (P::check_if_in_cycle && !(number_of_rounds_running % 2)) {
 
-            #if (GAME_DEBUG)
-                Serial.println("Print board two moves ago");
+        #if (GAME_DEBUG)
+            Serial.println("Print board two moves ago");
 
-                board_two_ago->print();
-                board->print();
-            #endif /* GAME_DEBUG */
+            board_two_ago->print();
+            board->print();
+        #endif /* GAME_DEBUG */
 
-            #if (CONWAY_CHECK_HISTORY)
-                board_same = true;
-            #endif /* CONWAY_CHECK_HISTORY */
+        board_same = true;
 
-            for (i_row = 0; i_row < height; i_row++) {
-                if (!board_same) break;
+        for (i_row = 0; i_row < height; i_row++) {
+            if (!board_same) break;
 
-                for (i_col = 0; i_col < width; i_col++) {
-                    if (board_two_ago->getState(i_col, i_row) != board->getState(i_col, i_row)){
-                        board_same = false;
-                        break;
-                    }
+            for (i_col = 0; i_col < width; i_col++) {
+                if (board_two_ago->getState(i_col, i_row) != board->getState(i_col, i_row)){
+                    board_same = false;
+                    break;
                 }
-
-                if (!board_same) break;
             }
 
-            if (board_same) {
+            if (!board_same) break;
+        }
 
-                #if (GAME_DEBUG)
-                    Serial.println("Board Stuck in cycle");
-                #endif /* GAME_DEBUG */
+        if (board_same) {
 
-                #if (CONWAY_CYCLE_DETECTED_BUFFER > 0)
-                    number_of_moves_since_cycle_detected++;
+            #if (GAME_DEBUG)
+                Serial.println("Board Stuck in cycle");
+            #endif /* GAME_DEBUG */
 
-                    if (number_of_moves_since_cycle_detected >= CONWAY_CYCLE_DETECTED_BUFFER) _newRound();
+            #if (CONWAY_CYCLE_DETECTED_BUFFER > 0)
+                number_of_moves_since_cycle_detected++;
 
-                    return;
-                #endif /* CONWAY_CYCLE_DETECTED_BUFFER */
+                if (number_of_moves_since_cycle_detected >= CONWAY_CYCLE_DETECTED_BUFFER) _newRound();
 
-                _newRound();
                 return;
-            }
+            #endif /* CONWAY_CYCLE_DETECTED_BUFFER */
+
+            _newRound();
+            return;
         }
-    #endif /* CONWAY_CHECK_IF_IN_CYCLE */
+    }
 }
 
 #endif /* Conway_h */
@@ -0,0 +1,904 @@
+#ifndef ConwayPacked_h
+#define ConwayPacked_h
+
+/*******************************************************************************
+ *                                  Includes                                   *
+ *******************************************************************************/
+
+#include <Arduino.h>
+
+
+/*******************************************************************************
+ *                               Local Includes                                *
+ *******************************************************************************/
+
+#include "Boards/Board.h"
+
+
+/*******************************************************************************
+ *                           Conway Packed Settings                            *
+ *******************************************************************************/
+
+/**
+ * Use density for positions, unless told otherwise when constructed. Must
+ * match the setting used by Conway, as the packed board stores whether a
+ * living cell had exactly 3 neighbors so it can write back the same state
+ * Conway would.
+ */
+#ifndef CONWAY_ASSIGN_DENSITY
+    #define CONWAY_ASSIGN_DENSITY true
+#endif /* CONWAY_ASSIGN_DENSITY */
+
+/**
+ * Compile the SSE2 and AVX2 kernels. These are picked at startup depending on
+ * what the CPU supports, with the scalar kernel as the fallback. Only available
+ * on x86 hosts built with GCC or Clang.
+ */
+#ifndef CONWAY_PACKED_SIMD
+    #if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+        #define CONWAY_PACKED_SIMD true
+    #else
+        #define CONWAY_PACKED_SIMD false
+    #endif /* __GNUC__ && x86 */
+#endif /* CONWAY_PACKED_SIMD */
+
+
+/*******************************************************************************
+ *                                  Kernels                                    *
+ *******************************************************************************/
+
+#ifndef CONWAY_PACKED_KERNEL_SCALAR
+    #define CONWAY_PACKED_KERNEL_SCALAR 0
+#endif /* CONWAY_PACKED_KERNEL_SCALAR */
+
+#ifndef CONWAY_PACKED_KERNEL_SSE2
+    #define CONWAY_PACKED_KERNEL_SSE2 CONWAY_PACKED_KERNEL_SCALAR + 1
+#endif /* CONWAY_PACKED_KERNEL_SSE2 */
+
+#ifndef CONWAY_PACKED_KERNEL_AVX2
+    #define CONWAY_PACKED_KERNEL_AVX2 CONWAY_PACKED_KERNEL_SSE2 + 1
+#endif /* CONWAY_PACKED_KERNEL_AVX2 */
+
+/**
+ * Counts a kernel produces while stepping, taken with popcount on the words it
+ * writes anyway. Births and deaths follow from these and the last population.
+ */
+struct ConwayPackedCounts {
+    uint32_t population;
+    uint32_t changed;
+};
+
+/**
+ * Step `num_words` columns of 64 cells for rows [1, height]. Returns how many
+ * cells are alive in, and changed into, the next generation.
+ */
+typedef ConwayPackedCounts (*ConwayPackedKernel)(
+    const uint64_t * alive,
+    uint64_t * alive_next,
+    uint64_t * dense_next,
+    const uint64_t * masks,
+    uint16_t num_words,
+    uint16_t num_rows
+);
+
+#if (CONWAY_PACKED_SIMD)
+    typedef uint64_t ConwayPackedSSE2 __attribute__((vector_size(16), aligned(8)));
+    typedef uint64_t ConwayPackedAVX2 __attribute__((vector_size(32), aligned(8)));
+#endif /* CONWAY_PACKED_SIMD */
+
+/**
+ * Load a vector of consecutive words. `V` is either a single `uint64_t` or a
+ * GCC vector of them, one lane per row. The vector is written through a
+ * reference, as returning a 32 byte vector from a function built without AVX
+ * changes the ABI.
+ *
+ * @param  {V &}              vector
+ * @param  {const uint64_t *} words
+ */
+template <class V>
+static inline __attribute__((always_inline)) void _conwayPackedLoad(V & vector, const uint64_t * words) {
+    memcpy(&vector, words, sizeof(V));
+}
+
+/**
+ * Store a vector of consecutive words
+ *
+ * @param  {uint64_t *} words
+ * @param  {const V &}  vector
+ */
+template <class V>
+static inline __attribute__((always_inline)) void _conwayPackedStore(uint64_t * words, const V & vector) {
+    memcpy(words, &vector, sizeof(V));
+}
+
+/**
+ * Count the set bits of every lane
+ *
+ * @param  {const V &} vector
+ * @return {uint32_t}         number of set bits
+ */
+template <class V>
+static inline __attribute__((always_inline)) uint32_t _conwayPackedPopcount(const V & vector) {
+    uint64_t words[sizeof(V) / sizeof(uint64_t)];
+    uint32_t count = 0;
+
+    memcpy(words, &vector, sizeof(V));
+
+    for (uint16_t i_lane = 0; i_lane < sizeof(V) / sizeof(uint64_t); i_lane++) {
+        count += __builtin_popcountll(words[i_lane]);
+    }
+
+    return count;
+}
+
+/**
+ * Step rows of one word column, `sizeof(V) / 8` rows at a time. The neighbor
+ * count is done bit sliced: each row of three is summed with adders, then the
+ * three sums are added, so every bit of a word is a cell counted in parallel.
+ *
+ * @param  {const uint64_t *}   alive       current board, padded
+ * @param  {uint64_t *}         alive_next  next board, padded
+ * @param  {uint64_t *}         dense_next  cells that had exactly 3 neighbors
+ * @param  {uint64_t}           mask        cells inside the board for column
+ * @param  {uint16_t}           i_word      padded word column, >= 1
+ * @param  {uint16_t}           num_rows    padded rows per column
+ * @param  {uint16_t}           i_row       first padded row to step
+ * @param  {ConwayPackedCounts &} counts  added to for every row stepped
+ * @return {uint16_t}                       first row not stepped
+ */
+template <class V>
+static inline __attribute__((always_inline)) uint16_t _conwayPackedStepColumn(
+    const uint64_t * alive,
+    uint64_t * alive_next,
+    uint64_t * dense_next,
+    uint64_t mask,
+    uint16_t i_word,
+    uint16_t num_rows,
+    uint16_t i_row,
+    ConwayPackedCounts & counts
+) {
+    const uint16_t lanes = sizeof(V) / sizeof(uint64_t);
+    const uint16_t row_end = num_rows - 1;
+
+    const uint64_t * west = alive + (i_word - 1) * num_rows;
+    const uint64_t * center = alive + i_word * num_rows;
+    const uint64_t * east = alive + (i_word + 1) * num_rows;
+
+    V up_0, up_1, middle_0, middle_1, down_0, down_1;
+    V sum_0, sum_1, sum_2, carry, carry_next;
+    V cell, cell_west, cell_east, w, c, e;
+    V two_or_three, next;
+
+    for (; i_row + lanes <= row_end; i_row += lanes) {
+
+        /**
+         * Row above: full adder of west, center and east
+         */
+        _conwayPackedLoad<V>(c, center + i_row - 1);
+        _conwayPackedLoad<V>(w, west + i_row - 1);
+        _conwayPackedLoad<V>(e, east + i_row - 1);
+        w = (c << 1) | (w >> 63);
+        e = (c >> 1) | (e << 63);
+        up_0 = w ^ c ^ e;
+        up_1 = (w & c) | (e & (w ^ c));
+
+        /**
+         * Same row: half adder of west and east
+         */
+        _conwayPackedLoad<V>(cell, center + i_row);
+        _conwayPackedLoad<V>(cell_west, west + i_row);
+        _conwayPackedLoad<V>(cell_east, east + i_row);
+        w = (cell << 1) | (cell_west >> 63);
+        e = (cell >> 1) | (cell_east << 63);
+        middle_0 = w ^ e;
+        middle_1 = w & e;
+
+        /**
+         * Row below: full adder of west, center and east
+         */
+        _conwayPackedLoad<V>(c, center + i_row + 1);
+        _conwayPackedLoad<V>(w, west + i_row + 1);
+        _conwayPackedLoad<V>(e, east + i_row + 1);
+        w = (c << 1) | (w >> 63);
+        e = (c >> 1) | (e << 63);
+        down_0 = w ^ c ^ e;
+        down_1 = (w & c) | (e & (w ^ c));
+
+        /**
+         * Add above and below, then the same row. Counts of 8 overflow out of
+         * bit 2 and read as 0, which is fine as only 2 and 3 matter.
+         */
+        sum_0 = up_0 ^ down_0;
+        carry = up_0 & down_0;
+        sum_1 = up_1 ^ down_1 ^ carry;
+        sum_2 = (up_1 & down_1) | (carry & (up_1 ^ down_1));
+
+        carry = sum_0 & middle_0;
+        sum_0 = sum_0 ^ middle_0;
+        carry_next = (sum_1 & middle_1) | (carry & (sum_1 ^ middle_1));
+        sum_1 = sum_1 ^ middle_1 ^ carry;
+        sum_2 = sum_2 ^ carry_next;
+
+        two_or_three = sum_1 & ~sum_2;
+        next = two_or_three & (sum_0 | cell) & mask;
+
+        _conwayPackedStore<V>(alive_next + i_word * num_rows + i_row, next);
+        _conwayPackedStore<V>(dense_next + i_word * num_rows + i_row, two_or_three & sum_0 & mask);
+
+        /**
+         * Halo cells past width sit in `cell` too, so mask the change
+         */
+        counts.population += _conwayPackedPopcount<V>(next);
+        counts.changed += _conwayPackedPopcount<V>((next ^ cell) & mask);
+    }
+
+    return i_row;
+}
+
+/**
+ * Scalar kernel, one row of 64 cells at a time
+ */
+static ConwayPackedCounts _conwayPackedKernelScalar(
+    const uint64_t * alive,
+    uint64_t * alive_next,
+    uint64_t * dense_next,
+    const uint64_t * masks,
+    uint16_t num_words,
+    uint16_t num_rows
+) {
+    ConwayPackedCounts counts = {0, 0};
+
+    for (uint16_t i_word = 1; i_word <= num_words; i_word++) {
+        _conwayPackedStepColumn<uint64_t>(alive, alive_next, dense_next, masks[i_word], i_word, num_rows, 1, counts);
+    }
+
+    return counts;
+}
+
+#if (CONWAY_PACKED_SIMD)
+    /**
+     * SSE2 kernel, 2 rows of 64 cells at a time. Leftover rows go through the
+     * scalar path. SSE2 alone has no popcount instruction, so counts go through
+     * the compiler's fallback.
+     */
+    __attribute__((target("sse2")))
+    static ConwayPackedCounts _conwayPackedKernelSSE2(
+        const uint64_t * alive,
+        uint64_t * alive_next,
+        uint64_t * dense_next,
+        const uint64_t * masks,
+        uint16_t num_words,
+        uint16_t num_rows
+    ) {
+        ConwayPackedCounts counts = {0, 0};
+        uint16_t i_row;
+
+        for (uint16_t i_word = 1; i_word <= num_words; i_word++) {
+            i_row = _conwayPackedStepColumn<ConwayPackedSSE2>(alive, alive_next, dense_next, masks[i_word], i_word, num_rows, 1, counts);
+            _conwayPackedStepColumn<uint64_t>(alive, alive_next, dense_next, masks[i_word], i_word, num_rows, i_row, counts);
+        }
+
+        return counts;
+    }
+
+    /**
+     * AVX2 kernel, 4 rows of 64 cells at a time. Leftover rows go through the
+     * scalar path. Every AVX2 CPU has POPCNT, so counts use it too.
+     */
+    __attribute__((target("avx2,popcnt")))
+    static ConwayPackedCounts _conwayPackedKernelAVX2(
+        const uint64_t * alive,
+        uint64_t * alive_next,
+        uint64_t * dense_next,
+        const uint64_t * masks,
+        uint16_t num_words,
+        uint16_t num_rows
+    ) {
+        ConwayPackedCounts counts = {0, 0};
+        uint16_t i_row;
+
+        for (uint16_t i_word = 1; i_word <= num_words; i_word++) {
+            i_row = _conwayPackedStepColumn<ConwayPackedAVX2>(alive, alive_next, dense_next, masks[i_word], i_word, num_rows, 1, counts);
+            _conwayPackedStepColumn<uint64_t>(alive, alive_next, dense_next, masks[i_word], i_word, num_rows, i_row, counts);
+        }
+
+        return counts;
+    }
+#endif /* CONWAY_PACKED_SIMD */
+
+
+/*******************************************************************************
+ *                               Conway Packed                                 *
+ *******************************************************************************/
+
+/**
+ * Bit packed Conway board. One bit per cell, 64 cells per word, stored column
+ * of words first so that a vector load picks up the same word of consecutive
+ * rows. The board is padded by a dead word column on each side and a dead row
+ * above and below, so edges need no special casing.
+ *
+ * Alongside the living cells a second plane keeps which living cells had
+ * exactly 3 neighbors, which is all that is needed to reproduce the density
+ * states written by Conway.
+ */
+class ConwayPacked {
+private:
+    uint16_t width;
+    uint16_t height;
+
+    uint16_t num_words;
+    uint16_t num_rows;
+    uint32_t num_words_total;
+
+    uint64_t * alive;
+    uint64_t * alive_next;
+    uint64_t * dense;
+    uint64_t * dense_next;
+    uint64_t * masks;
+
+    /**
+     * Generation kept by `storeTwoAgo`, NULL unless asked for
+     */
+    uint64_t * alive_two_ago;
+    uint64_t * dense_two_ago;
+    bool two_ago_canonical;
+
+    /**
+     * False if the Board holds states the packed board cannot reproduce, e.g.
+     * right after a new round. The next `copyToBoard` then writes every cell.
+     */
+    bool canonical;
+
+    /**
+     * Population of the current generation, or of the next one once stepped,
+     * and the births and deaths of the last step
+     */
+    uint32_t population;
+    uint32_t births;
+    uint32_t deaths;
+
+    /**
+     * Living cells with exactly 3 neighbors are written as such
+     */
+    bool assign_density;
+
+    /**
+     * Density states only differ if a cell holds more than 1 bit
+     */
+    bool dense_states;
+
+    static ConwayPackedKernel kernel;
+    static uint8_t kernel_level;
+
+    uint8_t _stateFor(bool is_alive, bool is_dense) const;
+    void _setHaloEast(uint16_t i_row, bool is_alive);
+
+public:
+    ConwayPacked(
+        uint16_t _width,
+        uint16_t _height,
+        bool _assign_density = CONWAY_ASSIGN_DENSITY,
+        bool _two_ago = false
+    );
+    ~ConwayPacked();
+
+    static bool useKernel(uint8_t level);
+    static uint8_t getKernel();
+    static const char * getKernelName();
+
+    uint16_t getWidth() const;
+    uint16_t getHeight() const;
+    bool anyAlive() const;
+    uint32_t getPopulation() const;
+    uint32_t getBirths() const;
+    uint32_t getDeaths() const;
+
+    void copyFromBoard(Board * board);
+    bool copyToBoard(Board * board);
+
+    void setAlive(uint16_t x, uint16_t y);
+    bool getAlive(uint16_t x, uint16_t y) const;
+
+    void getRow(uint16_t y, uint64_t * bits) const;
+    void getColumn(uint16_t x, uint64_t * bits) const;
+    void setHaloRow(bool bottom, const uint64_t * bits, bool west, bool east);
+    void setHaloColumn(bool east, const uint64_t * bits);
+
+    void step();
+
+    void storeTwoAgo();
+    bool sameAsTwoAgo() const;
+
+    static constexpr uint32_t sramBytes(uint16_t _width, uint16_t _height, bool _two_ago = false);
+    static constexpr uint16_t sramBlocks(bool _two_ago = false);
+};
+
+/**
+ * Heap a packed board allocates, the object itself not included. Boards of
+ * words padded by one on every side, 4 of them or 6 keeping two ago, and the
+ * masks.
+ *
+ * @param  {uint16_t} _width
+ * @param  {uint16_t} _height
+ * @param  {bool}     _two_ago  as constructed
+ * @return {uint32_t}           bytes
+ */
+constexpr uint32_t ConwayPacked::sramBytes(uint16_t _width, uint16_t _height, bool _two_ago) {
+    return ((_two_ago ? 6 : 4) * (uint32_t)((_width + 63) / 64 + 2) * (_height + 2) + (_width + 63) / 64 + 2) * sizeof(uint64_t);
+}
+
+/**
+ * Heap blocks a packed board allocates, the object itself not included
+ *
+ * @param  {bool}     _two_ago  as constructed
+ * @return {uint16_t}           blocks
+ */
+constexpr uint16_t ConwayPacked::sramBlocks(bool _two_ago) {
+    return (_two_ago ? 6 : 4) + 1;
+}
+
+ConwayPackedKernel ConwayPacked::kernel = NULL;
+uint8_t ConwayPacked::kernel_level = CONWAY_PACKED_KERNEL_SCALAR;
+
+
+/**
+ * Init Conway Packed. Picks the widest kernel the CPU supports the first time
+ * one is constructed.
+ *
+ * @param {uint16_t} width
+ * @param {uint16_t} height
+ * @param {bool}     _assign_density  write density states as Conway does
+ *                                    with CONWAY_ASSIGN_DENSITY
+ * @param {bool}     _two_ago         keep a generation for `sameAsTwoAgo`
+ */
+ConwayPacked::ConwayPacked(
+    uint16_t _width,
+    uint16_t _height,
+    bool _assign_density,
+    bool _two_ago
+) {
+    width = _width;
+    height = _height;
+    assign_density = _assign_density;
+
+    num_words = (width + 63) / 64;
+    num_rows = height + 2;
+    num_words_total = (uint32_t)(num_words + 2) * num_rows;
+
+    alive = new uint64_t [num_words_total];
+    alive_next = new uint64_t [num_words_total];
+    dense = new uint64_t [num_words_total];
+    dense_next = new uint64_t [num_words_total];
+
+    memset(alive, 0, num_words_total * sizeof(uint64_t));
+    memset(alive_next, 0, num_words_total * sizeof(uint64_t));
+    memset(dense, 0, num_words_total * sizeof(uint64_t));
+    memset(dense_next, 0, num_words_total * sizeof(uint64_t));
+
+    alive_two_ago = _two_ago ? new uint64_t [num_words_total] : NULL;
+    dense_two_ago = _two_ago ? new uint64_t [num_words_total] : NULL;
+    two_ago_canonical = false;
+
+    /**
+     * Padding columns are never alive, last column only up to width
+     */
+    masks = new uint64_t [num_words + 2];
+    for (uint16_t i_word = 0; i_word < num_words + 2; i_word++) masks[i_word] = ~(uint64_t)0;
+    masks[0] = 0;
+    masks[num_words + 1] = 0;
+    if (width % 64) masks[num_words] = ((uint64_t)1 << (width % 64)) - 1;
+
+    canonical = true;
+    population = 0;
+    births = 0;
+    deaths = 0;
+    dense_states = _stateFor(true, true) != _stateFor(true, false);
+
+    if (kernel == NULL) {
+        if (!useKernel(CONWAY_PACKED_KERNEL_AVX2) && !useKernel(CONWAY_PACKED_KERNEL_SSE2)) {
+            useKernel(CONWAY_PACKED_KERNEL_SCALAR);
+        }
+    }
+}
+
+/**
+ * Free planes
+ */
+ConwayPacked::~ConwayPacked() {
+    delete [] alive;
+    delete [] alive_next;
+    delete [] dense;
+    delete [] dense_next;
+    delete [] masks;
+
+    delete [] alive_two_ago;
+    delete [] dense_two_ago;
+}
+
+/**
+ * Use kernel `level` for every packed board. Fails if not compiled in or not
+ * supported by this CPU.
+ *
+ * @param  {uint8_t} level  one of CONWAY_PACKED_KERNEL_*
+ * @return {bool}           truth of the kernel being used
+ */
+bool ConwayPacked::useKernel(uint8_t level) {
+    #if (CONWAY_PACKED_SIMD)
+        __builtin_cpu_init();
+
+        if (level == CONWAY_PACKED_KERNEL_AVX2) {
+            if (!__builtin_cpu_supports("avx2") || !__builtin_cpu_supports("popcnt")) return false;
+
+            kernel = _conwayPackedKernelAVX2;
+        }
+        else if (level == CONWAY_PACKED_KERNEL_SSE2) {
+            if (!__builtin_cpu_supports("sse2")) return false;
+
+            kernel = _conwayPackedKernelSSE2;
+        }
+        else if (level == CONWAY_PACKED_KERNEL_SCALAR) kernel = _conwayPackedKernelScalar;
+        else return false;
+    #else
+        if (level != CONWAY_PACKED_KERNEL_SCALAR) return false;
+
+        kernel = _conwayPackedKernelScalar;
+    #endif /* CONWAY_PACKED_SIMD */
+
+    kernel_level = level;
+
+    return true;
+}
+
+/**
+ * Get kernel in use
+ *
+ * @return {uint8_t} one of CONWAY_PACKED_KERNEL_*
+ */
+uint8_t ConwayPacked::getKernel() {
+    return kernel_level;
+}
+
+/**
+ * Get name of kernel in use
+ *
+ * @return {const char *} name
+ */
+const char * ConwayPacked::getKernelName() {
+    if (kernel_level == CONWAY_PACKED_KERNEL_AVX2) return "avx2";
+    if (kernel_level == CONWAY_PACKED_KERNEL_SSE2) return "sse2";
+
+    return "scalar";
+}
+
+/**
+ * Get width of board
+ *
+ * @return {uint16_t} width
+ */
+uint16_t ConwayPacked::getWidth() const {
+    return width;
+}
+
+/**
+ * Get height of board
+ *
+ * @return {uint16_t} height
+ */
+uint16_t ConwayPacked::getHeight() const {
+    return height;
+}
+
+/**
+ * Anything alive after the last step
+ *
+ * @return {bool} truth of any cell being alive
+ */
+bool ConwayPacked::anyAlive() const {
+    return population > 0;
+}
+
+/**
+ * Get number of living cells after the last step
+ *
+ * @return {uint32_t} population
+ */
+uint32_t ConwayPacked::getPopulation() const {
+    return population;
+}
+
+/**
+ * Get number of cells born in the last step
+ *
+ * @return {uint32_t} births
+ */
+uint32_t ConwayPacked::getBirths() const {
+    return births;
+}
+
+/**
+ * Get number of cells that died in the last step
+ *
+ * @return {uint32_t} deaths
+ */
+uint32_t ConwayPacked::getDeaths() const {
+    return deaths;
+}
+
+/**
+ * State Conway would write for a living cell
+ *
+ * @param  {bool}    is_alive
+ * @param  {bool}    is_dense   had exactly 3 neighbors
+ * @return {uint8_t}            state, capped to what CELL_WIDTH can hold
+ */
+uint8_t ConwayPacked::_stateFor(bool is_alive, bool is_dense) const {
+    if (!is_alive) return CELL_STATE_DEAD;
+
+    if (assign_density) return min(is_dense ? 3 : 2, (1 << (CELL_WIDTH)) - 1);
+
+    return CELL_STATE_ALIVE;
+}
+
+/**
+ * Pack `board` into this board
+ *
+ * @param  {Board *} board  board of the same size
+ */
+void ConwayPacked::copyFromBoard(Board * board) {
+    uint8_t state;
+    bool is_alive;
+    bool is_dense;
+    uint64_t * word;
+
+    memset(alive, 0, num_words_total * sizeof(uint64_t));
+    memset(dense, 0, num_words_total * sizeof(uint64_t));
+
+    canonical = true;
+    population = 0;
+    births = 0;
+    deaths = 0;
+
+    for (uint16_t i_row = 0; i_row < height; i_row++) {
+        for (uint16_t i_col = 0; i_col < width; i_col++) {
+            state = board->getState(i_col, i_row);
+
+            is_alive = state >= CELL_STATE_ALIVE;
+            is_dense = is_alive && (state == _stateFor(true, true));
+
+            if (state != _stateFor(is_alive, is_dense)) canonical = false;
+            if (!is_alive) continue;
+
+            population++;
+
+            word = alive + (i_col / 64 + 1) * num_rows + i_row + 1;
+            *word |= (uint64_t)1 << (i_col % 64);
+
+            if (is_dense) {
+                word = dense + (i_col / 64 + 1) * num_rows + i_row + 1;
+                *word |= (uint64_t)1 << (i_col % 64);
+            }
+        }
+    }
+}
+
+/**
+ * Set cell alive, as if a Board holding CELL_STATE_ALIVE there was copied in.
+ * Used to seed boards too large for a Board.
+ *
+ * @param  {uint16_t} x  x coordiante
+ * @param  {uint16_t} y  y coordiante
+ */
+void ConwayPacked::setAlive(uint16_t x, uint16_t y) {
+    uint64_t * word = alive + (x / 64 + 1) * num_rows + y + 1;
+
+    if (!(*word & ((uint64_t)1 << (x % 64)))) population++;
+
+    *word |= (uint64_t)1 << (x % 64);
+
+    if (_stateFor(true, false) != CELL_STATE_ALIVE) canonical = false;
+}
+
+/**
+ * Get if cell is alive in the current generation
+ *
+ * @param  {uint16_t} x  x coordiante
+ * @param  {uint16_t} y  y coordiante
+ * @return {bool}        truth of cell being alive
+ */
+bool ConwayPacked::getAlive(uint16_t x, uint16_t y) const {
+    return (alive[(x / 64 + 1) * num_rows + y + 1] >> (x % 64)) & 1;
+}
+
+/**
+ * Get row `y` of the current generation, bit x of the row is cell x
+ *
+ * @param  {uint16_t}   y     row
+ * @param  {uint64_t *} bits  (width + 63) / 64 words
+ */
+void ConwayPacked::getRow(uint16_t y, uint64_t * bits) const {
+    for (uint16_t i_word = 1; i_word <= num_words; i_word++) {
+        bits[i_word - 1] = alive[i_word * num_rows + y + 1] & masks[i_word];
+    }
+}
+
+/**
+ * Get column `x` of the current generation, bit y of the column is cell y
+ *
+ * @param  {uint16_t}   x     column
+ * @param  {uint64_t *} bits  (height + 63) / 64 words
+ */
+void ConwayPacked::getColumn(uint16_t x, uint64_t * bits) const {
+    const uint64_t * column = alive + (x / 64 + 1) * num_rows + 1;
+
+    memset(bits, 0, ((height + 63) / 64) * sizeof(uint64_t));
+
+    for (uint16_t i_row = 0; i_row < height; i_row++) {
+        bits[i_row / 64] |= ((column[i_row] >> (x % 64)) & 1) << (i_row % 64);
+    }
+}
+
+/**
+ * Set the cell just east of the board on padded row `i_row`. Sits in the last
+ * word unless width fills it.
+ *
+ * @param  {uint16_t} i_row     padded row
+ * @param  {bool}     is_alive
+ */
+void ConwayPacked::_setHaloEast(uint16_t i_row, bool is_alive) {
+    if (width % 64) {
+        alive[num_words * num_rows + i_row] &= ~((uint64_t)1 << (width % 64));
+        alive[num_words * num_rows + i_row] |= (uint64_t)is_alive << (width % 64);
+    }
+    else alive[(num_words + 1) * num_rows + i_row] = is_alive;
+}
+
+/**
+ * Set the row of cells just above or below the board, including the corners,
+ * to what a neighboring board holds. Lets several packed boards step as one.
+ * Must be set again before every step.
+ *
+ * @param  {bool}             bottom  below the board if true, otherwise above
+ * @param  {const uint64_t *} bits    row as from `getRow`, NULL for all dead
+ * @param  {bool}             west    corner cell west of the row
+ * @param  {bool}             east    corner cell east of the row
+ */
+void ConwayPacked::setHaloRow(bool bottom, const uint64_t * bits, bool west, bool east) {
+    uint16_t i_row = bottom ? height + 1 : 0;
+
+    for (uint16_t i_word = 1; i_word <= num_words; i_word++) {
+        alive[i_word * num_rows + i_row] = bits == NULL ? 0 : bits[i_word - 1] & masks[i_word];
+    }
+
+    alive[i_row] = (uint64_t)west << 63;
+    alive[(num_words + 1) * num_rows + i_row] = 0;
+
+    _setHaloEast(i_row, east);
+}
+
+/**
+ * Set the column of cells just west or east of the board to what a
+ * neighboring board holds. Must be set again before every step.
+ *
+ * @param  {bool}             east  east of the board if true, otherwise west
+ * @param  {const uint64_t *} bits  column as from `getColumn`, NULL for all
+ *                                  dead
+ */
+void ConwayPacked::setHaloColumn(bool east, const uint64_t * bits) {
+    bool is_alive;
+
+    for (uint16_t i_row = 0; i_row < height; i_row++) {
+        is_alive = bits != NULL && ((bits[i_row / 64] >> (i_row % 64)) & 1);
+
+        if (east) _setHaloEast(i_row + 1, is_alive);
+        else alive[i_row + 1] = (uint64_t)is_alive << 63;
+    }
+}
+
+/**
+ * Step one generation. The result is held until `copyToBoard` is called, the
+ * counts are of the result straight away.
+ */
+void ConwayPacked::step() {
+    ConwayPackedCounts counts = kernel(alive, alive_next, dense_next, masks, num_words, num_rows);
+
+    /**
+     * changed = births + deaths and population grows by births - deaths
+     */
+    births = (counts.changed + counts.population - population) / 2;
+    deaths = counts.changed - births;
+    population = counts.population;
+}
+
+/**
+ * Write the last step to `board`, only touching cells that changed, then make
+ * it the current generation. `board` may be NULL to only advance.
+ *
+ * @param  {Board *} board  board of the same size, or NULL
+ * @return {bool}           truth of any cell state changing
+ */
+bool ConwayPacked::copyToBoard(Board * board) {
+    bool changed = !canonical;
+    uint64_t diff;
+    uint64_t * swap;
+    uint16_t i_col;
+    uint32_t index;
+
+    for (uint16_t i_word = 1; i_word <= num_words; i_word++) {
+        for (uint16_t i_row = 1; i_row <= height; i_row++) {
+            index = i_word * num_rows + i_row;
+
+            if (canonical) {
+                diff = alive[index] ^ alive_next[index];
+
+                if (dense_states) diff |= alive_next[index] & (dense[index] ^ dense_next[index]);
+            }
+            else diff = ~(uint64_t)0;
+
+            /**
+             * Halo cells past width are not part of the board
+             */
+            diff &= masks[i_word];
+
+            if (diff) changed = true;
+            if (board == NULL) continue;
+
+            while (diff) {
+                i_col = (i_word - 1) * 64 + __builtin_ctzll(diff);
+
+                board->setState(
+                    i_col,
+                    i_row - 1,
+                    _stateFor(
+                        (alive_next[index] >> (i_col % 64)) & 1,
+                        (dense_next[index] >> (i_col % 64)) & 1
+                    )
+                );
+
+                diff &= diff - 1;
+            }
+        }
+    }
+
+    swap = alive;
+    alive = alive_next;
+    alive_next = swap;
+
+    swap = dense;
+    dense = dense_next;
+    dense_next = swap;
+
+    canonical = true;
+
+    return changed;
+}
+
+/**
+ * Keep the current generation to compare against two moves from now. Only if
+ * constructed to keep two ago.
+ */
+void ConwayPacked::storeTwoAgo() {
+    memcpy(alive_two_ago, alive, num_words_total * sizeof(uint64_t));
+    memcpy(dense_two_ago, dense, num_words_total * sizeof(uint64_t));
+
+    two_ago_canonical = canonical;
+}
+
+/**
+ * Compare current generation against the one stored by `storeTwoAgo`
+ *
+ * @return {bool} truth of every cell state being the same
+ */
+bool ConwayPacked::sameAsTwoAgo() const {
+    if (!two_ago_canonical || !canonical) return false;
+
+    for (uint32_t index = 0; index < num_words_total; index++) {
+        if (alive[index] != alive_two_ago[index]) return false;
+
+        if (dense_states && (alive[index] & (dense[index] ^ dense_two_ago[index]))) return false;
+    }
+
+    return true;
+}
+
+
+#endif /* ConwayPacked_h */
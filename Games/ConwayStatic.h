@@ -0,0 +1,139 @@
+#ifndef ConwayStatic_h
+#define ConwayStatic_h
+
+/*******************************************************************************
+ *                                  Includes                                   *
+ *******************************************************************************/
+
+#include <Arduino.h>
+
+
+/*******************************************************************************
+ *                               Local Includes                                *
+ *******************************************************************************/
+
+#include "Conway.h"
+#include "GameStatic.h"
+
+
+/*******************************************************************************
+ *                            Conway Static Storage                            *
+ *******************************************************************************/
+
+/**
+ * Game storage plus the checking boards of a Conway set by policy `P`. The
+ * packed kernel keeps its own words on the heap, so there are none.
+ */
+template <uint8_t PW, uint8_t PH, uint8_t BX, uint8_t BY, class P>
+class ConwayStaticStorage : protected GameStaticStorage<PW, PH, BX, BY> {
+protected:
+    typedef GameStaticStorage<PW, PH, BX, BY> Storage;
+    typedef typename P::BoardNext BoardNext;
+
+    BoardStaticOptional<
+        !P::packed_kernel,
+        Storage::width_static,
+        ConwayBoardNextTraits<BoardNext>::height(Storage::height_static),
+        BoardNext
+    > board_next_static;
+
+    BoardStaticOptional<
+        !P::packed_kernel && P::check_if_in_cycle,
+        Storage::width_static,
+        Storage::height_static
+    > board_two_ago_static;
+
+    ConwayStaticStorage(uint8_t pin);
+};
+
+
+/**
+ * Init Conway Static Storage
+ *
+ * @param  {uint8_t} pin  Pin out on Arduino
+ */
+template <uint8_t PW, uint8_t PH, uint8_t BX, uint8_t BY, class P>
+ConwayStaticStorage<PW, PH, BX, BY, P>::ConwayStaticStorage(uint8_t pin): Storage(pin) { }
+
+
+/*******************************************************************************
+ *                                Conway Static                                *
+ *******************************************************************************/
+
+/**
+ * Conway set by policy `P` on `BX` by `BY` matrices of `PW` by `PH` LEDs with
+ * its boards and tables in the object, see GameStatic.h
+ */
+template <uint8_t PW, uint8_t PH, uint8_t BX, uint8_t BY, class P = ConwayPolicy<> >
+class ConwayStatic : private ConwayStaticStorage<PW, PH, BX, BY, P>, public ConwayT<P> {
+public:
+    ConwayStatic(uint8_t pin);
+
+    static constexpr SramUsage sram();
+
+    static constexpr SramUsage sram(
+        uint8_t num_pixels_width,
+        uint8_t num_pixels_height,
+        uint8_t num_boards_x,
+        uint8_t num_boards_y
+    );
+};
+
+
+/**
+ * SRAM of the game, see Game::sram. Only the packed kernel adds to the heap.
+ *
+ * @return {SramUsage}
+ */
+template <uint8_t PW, uint8_t PH, uint8_t BX, uint8_t BY, class P>
+constexpr SramUsage ConwayStatic<PW, PH, BX, BY, P>::sram() {
+    #if (CONWAY_PACKED_AVAILABLE)
+        return GameStaticStorage<PW, PH, BX, BY>::_sram(
+            sizeof(ConwayStatic),
+
+            P::packed_kernel
+                ? sizeof(ConwayPacked) + ConwayPacked::sramBytes(
+                    GameStaticStorage<PW, PH, BX, BY>::width_static,
+                    GameStaticStorage<PW, PH, BX, BY>::height_static,
+                    P::check_if_in_cycle
+                )
+                : 0,
+
+            P::packed_kernel ? 1 + ConwayPacked::sramBlocks(P::check_if_in_cycle) : 0
+        );
+    #else
+        return GameStaticStorage<PW, PH, BX, BY>::_sram(sizeof(ConwayStatic), 0, 0);
+    #endif /* CONWAY_PACKED_AVAILABLE */
+}
+
+/**
+ * SRAM of the game, asked the way the other games are asked. The panel is the
+ * one the game was made for.
+ *
+ * @return {SramUsage}
+ */
+template <uint8_t PW, uint8_t PH, uint8_t BX, uint8_t BY, class P>
+constexpr SramUsage ConwayStatic<PW, PH, BX, BY, P>::sram(uint8_t, uint8_t, uint8_t, uint8_t) {
+    return sram();
+}
+
+/**
+ * Init Conway Static
+ *
+ * @param  {uint8_t} pin  Pin out on Arduino
+ */
+template <uint8_t PW, uint8_t PH, uint8_t BX, uint8_t BY, class P>
+ConwayStatic<PW, PH, BX, BY, P>::ConwayStatic(uint8_t pin):
+    ConwayStaticStorage<PW, PH, BX, BY, P>(pin),
+    ConwayT<P>(
+        PW,
+        PH,
+        BX,
+        BY,
+        this->_storage(),
+        this->board_next_static.get(),
+        this->board_two_ago_static.get()
+    )
+{ }
+
+#endif /* ConwayStatic_h */
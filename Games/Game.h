@@ -31,6 +31,15 @@
     #define GAME_DEBUG false
 #endif /* GAME_DEBUG */
 
+/**
+ * Mirror the board over Serial as compact binary packets from `draw`, see
+ * SerialMirror.h, instead of printing it as text like GAME_DEBUG. Costs one
+ * more board of memory.
+ */
+#ifndef GAME_SERIAL_MIRROR
+    #define GAME_SERIAL_MIRROR false
+#endif /* GAME_SERIAL_MIRROR */
+
 /**
  * Set to above 0 to have a max number moves before automatic reset. May be used
  * as a quick and dirty way to not get stuck in a repeated state
@@ -46,6 +55,14 @@
     #define GAME_COUNT_MOVES true
 #endif /* GAME_COUNT_MOVES */
 
+/**
+ * Milliseconds between generations shown by `tick`. 0 shows them as fast as
+ * they can be computed.
+ */
+#ifndef GAME_TICK_MS
+    #define GAME_TICK_MS 10
+#endif /* GAME_TICK_MS */
+
 /**
  * GAME_BRIGHTNESS for NeoMatrix
  */
@@ -53,6 +70,102 @@
     #define GAME_BRIGHTNESS (uint8_t)50
 #endif /* GAME_BRIGHTNESS */
 
+/**
+ * Apply the NeoPixel gamma curve to the palette, the same way NeoMatrix did for
+ * 5-6-5 colors
+ */
+#ifndef GAME_PALETTE_GAMMA
+    #define GAME_PALETTE_GAMMA true
+#endif /* GAME_PALETTE_GAMMA */
+
+/**
+ * Turn the hue of the palette this much every draw, 256 being a full turn. Set
+ * to 0 to not rotate. Every cell is redrawn when the palette turns.
+ */
+#ifndef GAME_PALETTE_ROTATE
+    #define GAME_PALETTE_ROTATE 0
+#endif /* GAME_PALETTE_ROTATE */
+
+/**
+ * NeoMatrix layout of the pixels within a matrix and of the matrices as tiles
+ */
+#ifndef GAME_NEO_MATRIX_TYPE
+    #define GAME_NEO_MATRIX_TYPE ( \
+        NEO_TILE_TOP + NEO_TILE_LEFT + NEO_TILE_ROWS    + NEO_TILE_PROGRESSIVE + \
+        NEO_TILE_TOP + NEO_TILE_LEFT + NEO_TILE_COLUMNS + NEO_TILE_ZIGZAG \
+    )
+#endif /* GAME_NEO_MATRIX_TYPE */
+
+/**
+ * NeoPixel color order and speed of the strip
+ */
+#ifndef GAME_NEO_PIXEL_TYPE
+    #define GAME_NEO_PIXEL_TYPE (NEO_GRB + NEO_KHZ800)
+#endif /* GAME_NEO_PIXEL_TYPE */
+
+/**
+ * Bytes per pixel in the strip buffer, 4 if GAME_NEO_PIXEL_TYPE has white
+ */
+#ifndef GAME_PIXEL_BYTES
+    #define GAME_PIXEL_BYTES ( \
+        (((GAME_NEO_PIXEL_TYPE) >> 6) & 3) == (((GAME_NEO_PIXEL_TYPE) >> 4) & 3) ? 3 : 4 \
+    )
+#endif /* GAME_PIXEL_BYTES */
+
+/**
+ * Work out the strip index of every cell once in `init`, then draw by copying
+ * a state's bytes straight into the strip buffer rather than going through
+ * `drawPixel`, which redoes the tile and zigzag math for every pixel. Costs 2
+ * bytes per cell, so is off on AVR.
+ */
+#ifndef GAME_PIXEL_INDEX_MAP
+    #if defined(__AVR__)
+        #define GAME_PIXEL_INDEX_MAP false
+    #else
+        #define GAME_PIXEL_INDEX_MAP true
+    #endif /* __AVR__ */
+#endif /* GAME_PIXEL_INDEX_MAP */
+
+/**
+ * Board cells each LED shows along each side to start with, can be changed
+ * with `setZoom`. At 1 each LED is a cell, above 1 each LED shows how much of
+ * its block is alive as intensity.
+ */
+#ifndef GAME_ZOOM
+    #define GAME_ZOOM 1
+#endif /* GAME_ZOOM */
+
+/**
+ * Largest zoom `setZoom` allows. At 1 the intensity palette is left out.
+ */
+#ifndef GAME_ZOOM_MAX
+    #if defined(__AVR__)
+        #define GAME_ZOOM_MAX 1
+    #else
+        #define GAME_ZOOM_MAX 4
+    #endif /* __AVR__ */
+#endif /* GAME_ZOOM_MAX */
+
+/**
+ * Steps of intensity between a dead and a fully alive block when zoomed out
+ */
+#ifndef GAME_ZOOM_LEVELS
+    #define GAME_ZOOM_LEVELS 16
+#endif /* GAME_ZOOM_LEVELS */
+
+/**
+ * Size of the simulated board, 0 for the size of the LED panel at GAME_ZOOM.
+ * The panel shows a viewport of it that can be moved with `setViewport`. Width
+ * must be a multiple of CELLS_PER_BYTE and both must be at most 255.
+ */
+#ifndef GAME_BOARD_WIDTH
+    #define GAME_BOARD_WIDTH 0
+#endif /* GAME_BOARD_WIDTH */
+
+#ifndef GAME_BOARD_HEIGHT
+    #define GAME_BOARD_HEIGHT 0
+#endif /* GAME_BOARD_HEIGHT */
+
 /**
  * Clear board on redraw
  */
@@ -61,7 +174,7 @@
 #endif GAME_DRAW_CLEAR_ON_REDRAW /* GAME_DRAW_CLEAR_ON_REDRAW */
 
 /**
- * Simple draw mode, rows, then columns
+ * Simple draw mode, down each column, then on to the next
  */
 #ifndef GAME_DRAW_MODE_DEFAULT
     #define GAME_DRAW_MODE_DEFAULT 0
@@ -75,40 +188,74 @@
 #endif GAME_DRAW_MODE_ROW_WISE /* GAME_DRAW_MODE_ROW_WISE */
 
 /**
- * Draw board spiral style. Assumes board is equal in width and height. Uses
- * a bit more memory than typical col -> row draw
+ * Draw board spiral style, clockwise from the top left corner inwards
  */
 #ifndef GAME_DRAW_MODE_SPIRAL
     #define GAME_DRAW_MODE_SPIRAL GAME_DRAW_MODE_ROW_WISE + 1
 #endif GAME_DRAW_MODE_SPIRAL /* GAME_DRAW_MODE_SPIRAL */
 
 /**
- * Draw board spiral style. Assumes board is equal in width and height. Uses
- * a bit more memory than typical col -> row draw
+ * Draw board down one column and back up the next
+ */
+#ifndef GAME_DRAW_MODE_SERPENTINE
+    #define GAME_DRAW_MODE_SERPENTINE GAME_DRAW_MODE_SPIRAL + 1
+#endif /* GAME_DRAW_MODE_SERPENTINE */
+
+/**
+ * Draw board along a Hilbert curve, so each part of the board fills in as a
+ * block. Boards that aren't a square power of two skip the curve's cells off
+ * the board.
+ */
+#ifndef GAME_DRAW_MODE_HILBERT
+    #define GAME_DRAW_MODE_HILBERT GAME_DRAW_MODE_SERPENTINE + 1
+#endif /* GAME_DRAW_MODE_HILBERT */
+
+/**
+ * Draw mode to start with, can be changed with `setDrawMode`. Default and row
+ * wise are worked out from the position, the others from a table, see
+ * GAME_DRAW_ORDER_TABLE.
  */
 #ifndef GAME_DRAW_MODE
     #define GAME_DRAW_MODE GAME_DRAW_MODE_DEFAULT
     // #define GAME_DRAW_MODE GAME_DRAW_MODE_ROW_WISE
     // #define GAME_DRAW_MODE GAME_DRAW_MODE_SPIRAL
+    // #define GAME_DRAW_MODE GAME_DRAW_MODE_SERPENTINE
+    // #define GAME_DRAW_MODE GAME_DRAW_MODE_HILBERT
 #endif GAME_DRAW_MODE /* GAME_DRAW_MODE */
 
 /**
- * Draw board one row at a time.
+ * Keep the spiral, serpentine and Hilbert orders in a table, worked out once,
+ * 2 bytes per LED. On if GAME_DRAW_MODE is one of them. Without it,
+ * `setDrawMode` draws those modes in the default order instead.
+ */
+#ifndef GAME_DRAW_ORDER_TABLE
+    #define GAME_DRAW_ORDER_TABLE ( \
+        GAME_DRAW_MODE == GAME_DRAW_MODE_SPIRAL \
+        || GAME_DRAW_MODE == GAME_DRAW_MODE_SERPENTINE \
+        || GAME_DRAW_MODE == GAME_DRAW_MODE_HILBERT \
+    )
+#endif /* GAME_DRAW_ORDER_TABLE */
+
+/**
+ * Sweep a marker across the board in draw order, a line at a time, showing
+ * each line's latest state as it passes. Moves on with time on every draw
+ * instead of blocking, so the game keeps stepping while it sweeps.
  */
 #ifndef GAME_DRAW_EFFECT_WIPE
     #define GAME_DRAW_EFFECT_WIPE false
 #endif GAME_DRAW_EFFECT_WIPE /* GAME_DRAW_EFFECT_WIPE */
 
 /**
- * Additional delay between pixel draws. This is in addition to the delay
- * imposed by redrawing by the NeoMatrix library
+ * Milliseconds for the wipe to move on by one line, or one cell. Set to 0 to
+ * move it on by one every draw.
  */
 #ifndef GAME_DRAW_EFFECT_WIPE_DELAY
     #define GAME_DRAW_EFFECT_WIPE_DELAY 0
 #endif GAME_DRAW_EFFECT_WIPE_DELAY /* GAME_DRAW_EFFECT_WIPE_DELAY */
 
 /**
- * Redraws board one cell at a time. This will make the effect quite slow.
+ * Wipe one cell at a time instead of one line. Always the case for spiral and
+ * Hilbert.
  */
 #ifndef GAME_DRAW_EFFECT_PER_CELL
     #define GAME_DRAW_EFFECT_PER_CELL false
@@ -121,6 +268,15 @@
     #define GAME_DRAW_EFFECT_DRAW_MARKER true
 #endif GAME_DRAW_EFFECT_DRAW_MARKER /* GAME_DRAW_EFFECT_DRAW_MARKER */
 
+/**
+ * Only redraw cells the board marked dirty, and skip `show` if there are none.
+ * Needs BOARD_TRACK_DIRTY. The wipe effects and clearing on redraw touch every
+ * cell anyway, so those always redraw the full board.
+ */
+#ifndef GAME_DRAW_DIRTY_ONLY
+    #define GAME_DRAW_DIRTY_ONLY (BOARD_TRACK_DIRTY && !GAME_DRAW_EFFECT_WIPE && !GAME_DRAW_CLEAR_ON_REDRAW)
+#endif /* GAME_DRAW_DIRTY_ONLY */
+
 
 /*******************************************************************************
  *                                Cell States                                  *
@@ -150,11 +306,66 @@
     #define CELL_STATE_MAX CELL_STATE_ALIVE_HIGH
 #endif /* CELL_STATE_MAX */
 
+/**
+ * Entries in the drawn palette, one per state then, when zooming out, one per
+ * intensity level
+ */
+#if (GAME_ZOOM_MAX > 1)
+    #define GAME_PALETTE_SIZE (CELL_STATE_MAX + 1 + GAME_ZOOM_LEVELS + 1)
+#else
+    #define GAME_PALETTE_SIZE (CELL_STATE_MAX + 1)
+#endif /* GAME_ZOOM_MAX */
+
 /*******************************************************************************
  *                               Local Includes                                *
  *******************************************************************************/
 
+#include "Profile.h"
+#include "Sram.h"
 #include "Boards/Board.h"
+#include "Recorder.h"
+
+#if (GAME_SERIAL_MIRROR)
+    #include "SerialMirror.h"
+#endif /* GAME_SERIAL_MIRROR */
+
+
+/*******************************************************************************
+ *                                 Game Stats                                  *
+ *******************************************************************************/
+
+/**
+ * Counts for the current round, kept up to date by `update` as a by-product of
+ * stepping. Births and deaths are of the last generation only.
+ */
+struct GameStats {
+    uint16_t generation;
+    uint16_t population;
+    uint16_t births;
+    uint16_t deaths;
+};
+
+
+/*******************************************************************************
+ *                                Game Storage                                 *
+ *******************************************************************************/
+
+/**
+ * What a game otherwise allocates by panel size, for keeping it elsewhere.
+ * `draw_order` and `pixel_index` take an entry per LED.
+ */
+struct GameStorage {
+    Adafruit_NeoMatrix * led_matrix;
+    Board * board;
+
+    #if (GAME_DRAW_ORDER_TABLE)
+        uint16_t * draw_order;
+    #endif /* GAME_DRAW_ORDER_TABLE */
+
+    #if (GAME_PIXEL_INDEX_MAP)
+        uint16_t * pixel_index;
+    #endif /* GAME_PIXEL_INDEX_MAP */
+};
 
 
 /*******************************************************************************
@@ -164,20 +375,135 @@
 
 class Game {
 private:
-    #if (GAME_DRAW_MODE_SPIRAL)
-        uint8_t spiral_spins;
-        uint8_t i_spiral_spin;
-        uint8_t spiral_width;
-        uint8_t spiral_height;
+    uint8_t draw_mode;
+
+    #if (GAME_DRAW_ORDER_TABLE)
+        /**
+         * Cell at each position in draw order, column in the high byte and
+         * row in the low byte
+         */
+        uint16_t * draw_order;
+
+        void _buildDrawOrder();
+        void _buildSpiralOrder();
+        void _buildHilbertOrder();
+    #endif /* GAME_DRAW_ORDER_TABLE */
+
+    static bool _drawModeHasTable(uint8_t mode);
+
+    #if (GAME_DRAW_EFFECT_WIPE)
+        /**
+         * Draw order position of the line under the marker, and when the
+         * wipe last moved on
+         */
+        uint16_t wipe_position;
+        uint8_t wipe_line;
+        uint32_t wipe_last_ms;
+
+        bool _advanceWipe();
+    #endif /* GAME_DRAW_EFFECT_WIPE */
+
+    void _drawOrderCell(uint16_t i_position);
+
+    /**
+     * LED panel size, and the board cell at its top left and cells per LED
+     */
+    uint8_t display_width;
+    uint8_t display_height;
+    uint8_t view_x;
+    uint8_t view_y;
+    uint8_t zoom;
+
+    /**
+     * Viewport moved since the last draw, so every LED needs redrawing
+     */
+    bool view_moved;
+
+    void _drawCell(uint8_t x, uint8_t y);
+    void _drawAll();
+
+    #if (GAME_DRAW_DIRTY_ONLY)
+        bool _drawDirty();
+    #endif /* GAME_DRAW_DIRTY_ONLY */
+
+    #if (GAME_PIXEL_INDEX_MAP)
+        uint8_t matrix_width;
+        uint8_t matrix_height;
+        uint8_t tiles_x;
+        uint8_t tiles_y;
+
+        /**
+         * Strip index of each LED, row by row
+         */
+        uint16_t * pixel_index;
+
+        /**
+         * Strip bytes of each palette entry, GAME_PIXEL_BYTES per entry
+         */
+        uint8_t pixel_bytes[GAME_PALETTE_SIZE * GAME_PIXEL_BYTES];
+        uint8_t * pixels;
+
+        void _buildPixelIndex();
+    #else
+        /**
+         * 24-bit color of each palette entry as handed to the strip
+         */
+        uint32_t pixel_colors[GAME_PALETTE_SIZE];
+    #endif /* GAME_PIXEL_INDEX_MAP */
+
+    uint8_t brightness;
+    uint8_t palette_hue;
+
+    /**
+     * millis() at which `tick` next runs
+     */
+    uint32_t next_tick;
+
+    /**
+     * Seeds of the rounds, drawn from the seed `init` was given, and the one
+     * game_random was seeded with for this round
+     */
+    Random round_random;
+    uint32_t round_seed;
+
+    #if (GAME_RECORD)
+        Recorder recorder;
+
+        void _recordGeneration();
+    #endif /* GAME_RECORD */
+
+    uint32_t _rotateColor(uint32_t color) const;
 
-        void _drawSpiralCell(uint8_t x, uint8_t y);
-    #endif /* GAME_DRAW_MODE_SPIRAL */
+    void _setSize(
+        uint8_t num_pixels_width,
+        uint8_t num_pixels_height,
+        uint8_t num_boards_x,
+        uint8_t num_boards_y
+    );
+    void _setUp();
+
+    static constexpr SramUsage _sram(
+        uint8_t _display_width,
+        uint8_t _display_height,
+        uint8_t _width,
+        uint8_t _height
+    );
 
 protected:
     Adafruit_NeoMatrix * led_matrix;
 
     Board * board;
 
+    /**
+     * Truth of the matrix, board and tables being allocated by the game,
+     * rather than kept by the caller
+     */
+    bool owns_storage;
+
+    #if (GAME_SERIAL_MIRROR)
+        SerialMirror * serial_mirror;
+    #endif /* GAME_SERIAL_MIRROR */
+
     #if (GAME_COUNT_MOVES > 0)
         uint16_t number_of_rounds_running;
     #endif /* GAME_COUNT_MOVES */
@@ -187,9 +513,33 @@ protected:
     uint8_t width;
     uint8_t height;
 
-    uint16_t * colors;
+    /**
+     * 24-bit color of each state, as from Adafruit_NeoPixel::Color
+     */
+    uint32_t colors[CELL_STATE_MAX + 1];
+
+    /**
+     * Incremented by every new round, so callers can tell a round ended
+     */
+    uint16_t number_of_new_rounds;
+
+    GameStats stats;
 
     virtual void _newRound();
+    void _countMove();
+
+    void _updatePalette();
+    void _drawPixel(uint8_t x, uint8_t y, uint8_t state);
+
+    static uint32_t _configMix(uint32_t config, uint32_t value);
+
+    Game(
+        uint8_t num_pixels_width,
+        uint8_t num_pixels_height,
+        uint8_t num_boards_x,
+        uint8_t num_boards_y,
+        const GameStorage & storage
+    );
 
 public:
     Game(
@@ -199,13 +549,151 @@ public:
         uint8_t num_boards_y,
         uint8_t pin
     );
+    virtual ~Game();
 
     virtual void init();
+    void init(uint32_t seed);
     virtual void update();
     void draw();
+    bool tick();
+
+    uint16_t advance(uint16_t generations);
+
+    const GameStats & getStats() const;
+    uint8_t getDensity() const;
+
+    uint32_t getSeed() const;
+    uint32_t getRoundSeed() const;
+    virtual const char * getName() const;
+    virtual uint32_t getConfig() const;
+
+    void setBrightness(uint8_t _brightness);
+    void rotatePalette(uint8_t hue);
+
+    const uint8_t * getPixels();
+    uint16_t getNumPixels() const;
+    Adafruit_NeoMatrix * getMatrix();
+    Board * getBoard();
+    const uint32_t * getColors() const;
+
+    void setDrawMode(uint8_t mode);
+    uint8_t getDrawMode() const;
+
+    void setViewport(uint8_t x, uint8_t y);
+    void setZoom(uint8_t _zoom);
+    uint8_t getViewX() const;
+    uint8_t getViewY() const;
+    uint8_t getZoom() const;
+
+    #if (GAME_SERIAL_MIRROR)
+        SerialMirror * getSerialMirror();
+    #endif /* GAME_SERIAL_MIRROR */
+
+    #if (GAME_RECORD)
+        Recorder * getRecorder();
+    #endif /* GAME_RECORD */
+
+    #if (GAME_PROFILE)
+        void dumpProfile();
+    #endif /* GAME_PROFILE */
+
+    static constexpr SramUsage sram(
+        uint8_t num_pixels_width,
+        uint8_t num_pixels_height,
+        uint8_t num_boards_x,
+        uint8_t num_boards_y
+    );
 };
 
 
+/**
+ * SRAM a game on a panel that size takes once constructed, see Sram.h. Sizes
+ * come out as the constructor works them out, e.g.
+ *
+ *   static_assert(Game::sram(8, 8, 2, 2).fits(), "Game doesn't fit");
+ *
+ * Subclasses hide it with their own, adding what they allocate.
+ *
+ * @param  {uint8_t} num_pixels_width   Width of individual NeoMatrix
+ * @param  {uint8_t} num_pixels_height  Height of individual NeoMatrix
+ * @param  {uint8_t} num_boards_x       Number of boards in X direction
+ * @param  {uint8_t} num_boards_y       Number of boards in Y direction
+ * @return {SramUsage}
+ */
+constexpr SramUsage Game::sram(
+    uint8_t num_pixels_width,
+    uint8_t num_pixels_height,
+    uint8_t num_boards_x,
+    uint8_t num_boards_y
+) {
+    return _sram(
+        num_pixels_width * num_boards_x,
+        num_pixels_height * num_boards_y,
+        GAME_BOARD_WIDTH ? GAME_BOARD_WIDTH : (uint8_t)(num_pixels_width * num_boards_x * GAME_ZOOM),
+        GAME_BOARD_HEIGHT ? GAME_BOARD_HEIGHT : (uint8_t)(num_pixels_height * num_boards_y * GAME_ZOOM)
+    );
+}
+
+/**
+ * SRAM of a game with the panel and board sizes worked out
+ *
+ * @param  {uint8_t} _display_width   LEDs across the panel
+ * @param  {uint8_t} _display_height
+ * @param  {uint8_t} _width           board
+ * @param  {uint8_t} _height
+ * @return {SramUsage}
+ */
+constexpr SramUsage Game::_sram(
+    uint8_t _display_width,
+    uint8_t _display_height,
+    uint8_t _width,
+    uint8_t _height
+) {
+    return SramUsage {
+        _width,
+        _height,
+
+        (uint32_t)sizeof(Game),
+
+        (uint32_t)(sizeof(Adafruit_NeoMatrix) + (uint32_t)_display_width * _display_height * GAME_PIXEL_BYTES),
+
+        (uint32_t)(sizeof(Board) + Board::sramBytes(_width, _height)),
+
+        0,
+
+        (uint32_t)(
+            ((GAME_DRAW_ORDER_TABLE ? 1 : 0) + (GAME_PIXEL_INDEX_MAP ? 1 : 0))
+            * (uint32_t)_display_width * _display_height * sizeof(uint16_t)
+        ),
+
+        #if (GAME_SERIAL_MIRROR)
+            (uint32_t)(sizeof(SerialMirror) + SerialMirror::sramBytes(_width, _height)),
+        #else
+            0,
+        #endif /* GAME_SERIAL_MIRROR */
+
+        #if (GAME_PROFILE)
+            (uint32_t)sizeof(Profile),
+        #else
+            0,
+        #endif /* GAME_PROFILE */
+
+        /**
+         * Matrix and strip, board, tables and mirror
+         */
+        (uint16_t)(
+            2
+            + 1 + Board::sramBlocks()
+            + (GAME_DRAW_ORDER_TABLE ? 1 : 0)
+            + (GAME_PIXEL_INDEX_MAP ? 1 : 0)
+            #if (GAME_SERIAL_MIRROR)
+                + 1 + SerialMirror::sramBlocks()
+            #endif /* GAME_SERIAL_MIRROR */
+        )
+    };
+}
+
+
 /**
  * Constructor
  *
@@ -228,47 +716,215 @@ Game::Game(
         num_boards_x,
         num_boards_y,
         pin,
-        NEO_TILE_TOP + NEO_TILE_LEFT + NEO_TILE_ROWS    + NEO_TILE_PROGRESSIVE +
-        NEO_TILE_TOP + NEO_TILE_LEFT + NEO_TILE_COLUMNS + NEO_TILE_ZIGZAG,
-        NEO_GRB + NEO_KHZ800
+        GAME_NEO_MATRIX_TYPE,
+        GAME_NEO_PIXEL_TYPE
     );
 
-    width = led_matrix->width();
-    height = led_matrix->height();
+    _setSize(num_pixels_width, num_pixels_height, num_boards_x, num_boards_y);
+
+    #if (GAME_DRAW_ORDER_TABLE)
+        draw_order = new uint16_t [(uint16_t)display_width * display_height];
+    #endif /* GAME_DRAW_ORDER_TABLE */
+
+    #if (GAME_PIXEL_INDEX_MAP)
+        pixel_index = new uint16_t [(uint16_t)display_width * display_height];
+    #endif /* GAME_PIXEL_INDEX_MAP */
+
+    board = new Board(width, height);
+
+    owns_storage = true;
+
+    _setUp();
+}
+
+/**
+ * Constructor for a game in storage the caller keeps, e.g. static arrays, see
+ * GameStatic.h. The storage must be sized as the other constructor sizes it.
+ *
+ * @param  {uint8_t}             num_pixels_width   Width of individual NeoMatrix
+ * @param  {uint8_t}             num_pixels_height  Height of individual NeoMatrix
+ * @param  {uint8_t}             num_boards_x       Number of boards in X direction
+ * @param  {uint8_t}             num_boards_y       Number of boards in Y direction
+ * @param  {const GameStorage &} storage
+ */
+Game::Game(
+    uint8_t num_pixels_width,
+    uint8_t num_pixels_height,
+    uint8_t num_boards_x,
+    uint8_t num_boards_y,
+    const GameStorage & storage
+) {
+    led_matrix = storage.led_matrix;
+
+    _setSize(num_pixels_width, num_pixels_height, num_boards_x, num_boards_y);
+
+    #if (GAME_DRAW_ORDER_TABLE)
+        draw_order = storage.draw_order;
+    #endif /* GAME_DRAW_ORDER_TABLE */
+
+    #if (GAME_PIXEL_INDEX_MAP)
+        pixel_index = storage.pixel_index;
+    #endif /* GAME_PIXEL_INDEX_MAP */
+
+    board = storage.board;
+
+    owns_storage = false;
+
+    _setUp();
+}
+
+/**
+ * Free what the game allocated, leaving storage the caller keeps
+ */
+Game::~Game() {
+    #if (GAME_SERIAL_MIRROR)
+        delete serial_mirror;
+    #endif /* GAME_SERIAL_MIRROR */
+
+    if (!owns_storage) return;
+
+    delete led_matrix;
+    delete board;
+
+    #if (GAME_DRAW_ORDER_TABLE)
+        delete [] draw_order;
+    #endif /* GAME_DRAW_ORDER_TABLE */
+
+    #if (GAME_PIXEL_INDEX_MAP)
+        delete [] pixel_index;
+    #endif /* GAME_PIXEL_INDEX_MAP */
+}
+
+/**
+ * Work out the panel and board sizes
+ *
+ * @param  {uint8_t} num_pixels_width   Width of individual NeoMatrix
+ * @param  {uint8_t} num_pixels_height  Height of individual NeoMatrix
+ * @param  {uint8_t} num_boards_x       Number of boards in X direction
+ * @param  {uint8_t} num_boards_y       Number of boards in Y direction
+ */
+void Game::_setSize(
+    uint8_t num_pixels_width,
+    uint8_t num_pixels_height,
+    uint8_t num_boards_x,
+    uint8_t num_boards_y
+) {
+    display_width = led_matrix->width();
+    display_height = led_matrix->height();
+
+    width = GAME_BOARD_WIDTH ? GAME_BOARD_WIDTH : display_width * GAME_ZOOM;
+    height = GAME_BOARD_HEIGHT ? GAME_BOARD_HEIGHT : display_height * GAME_ZOOM;
+
+    #if (GAME_PIXEL_INDEX_MAP)
+        matrix_width = num_pixels_width;
+        matrix_height = num_pixels_height;
+        tiles_x = num_boards_x;
+        tiles_y = num_boards_y;
+    #else
+        (void)num_pixels_width;
+        (void)num_pixels_height;
+        (void)num_boards_x;
+        (void)num_boards_y;
+    #endif /* GAME_PIXEL_INDEX_MAP */
+}
+
+/**
+ * Set everything else up once the matrix, board and tables are there
+ */
+void Game::_setUp() {
+    view_x = 0;
+    view_y = 0;
+    zoom = GAME_ZOOM;
+    view_moved = true;
+
+    #if (GAME_PIXEL_INDEX_MAP)
+        pixels = NULL;
+    #endif /* GAME_PIXEL_INDEX_MAP */
+
+    brightness = GAME_BRIGHTNESS;
+    palette_hue = 0;
+    next_tick = 0;
+    round_seed = 0;
+
+    #if (GAME_DRAW_EFFECT_WIPE)
+        wipe_last_ms = 0;
+    #endif /* GAME_DRAW_EFFECT_WIPE */
+
+    setDrawMode(GAME_DRAW_MODE);
 
     #if (GAME_COUNT_MOVES > 0)
         number_of_rounds_running = 0;
     #endif /* GAME_COUNT_MOVES */
 
-    board = new Board(width, height);
+    number_of_new_rounds = 0;
+
+    stats.generation = 0;
+    stats.population = 0;
+    stats.births = 0;
+    stats.deaths = 0;
+
     board->reset();
 
-    colors = new uint16_t [CELL_STATE_MAX + 1];
-    colors[CELL_STATE_DEAD]     = led_matrix->Color(0, 0, 0);
-    colors[CELL_STATE_ALIVE]    = led_matrix->Color(0, 255, 255);
+    #if (GAME_SERIAL_MIRROR)
+        serial_mirror = new SerialMirror(board, &Serial);
+    #endif /* GAME_SERIAL_MIRROR */
+
+    colors[CELL_STATE_DEAD]     = Adafruit_NeoPixel::Color(0, 0, 0);
+    colors[CELL_STATE_ALIVE]    = Adafruit_NeoPixel::Color(0, 255, 255);
 
     #if (CELL_STATE_MAX >= CELL_STATE_WIPE)
-        colors[CELL_STATE_WIPE] = led_matrix->Color(0, 0, 255);
+        colors[CELL_STATE_WIPE] = Adafruit_NeoPixel::Color(0, 0, 255);
     #endif /* CELL_STATE_MAX >= CELL_STATE_WIPE */
 
     #if (CELL_STATE_MAX >= CELL_STATE_ALIVE_LOW)
-        colors[CELL_STATE_ALIVE_LOW] = led_matrix->Color(0, 255, 0);
+        colors[CELL_STATE_ALIVE_LOW] = Adafruit_NeoPixel::Color(0, 255, 0);
     #endif /* CELL_STATE_MAX > CELL_STATE_ALIVE_LOW */
 
     #if (CELL_STATE_MAX >= CELL_STATE_ALIVE_HIGH)
-        colors[CELL_STATE_ALIVE_HIGH] = led_matrix->Color(255, 0, 0);
+        colors[CELL_STATE_ALIVE_HIGH] = Adafruit_NeoPixel::Color(255, 0, 0);
     #endif /* CELL_STATE_MAX > CELL_STATE_ALIVE_HIGH */
 }
 
 /**
- * Init game
+ * Init game, seeded with GAME_RANDOM_SEED or else noise
  */
 void Game::init() {
-    led_matrix->setBrightness(GAME_BRIGHTNESS);
+    init(GAME_RANDOM_SEED ? (uint32_t)GAME_RANDOM_SEED : Random::noiseSeed());
+}
+
+/**
+ * Init game seeded with `seed`, so the same seed plays the same rounds. Each
+ * round gets a seed of its own drawn from it, see `_newRound`.
+ *
+ * @param  {uint32_t} seed  see Random::seed
+ */
+void Game::init(uint32_t seed) {
+    round_random.seed(seed);
+
+    #if (GAME_RECORD)
+        recorder.session(getName(), display_width, display_height, width, height, getConfig(), seed);
+    #endif /* GAME_RECORD */
+
+    led_matrix->setBrightness(brightness);
     led_matrix->begin();
-    led_matrix->fillScreen(colors[CELL_STATE_DEAD]);
+
+    #if (GAME_PIXEL_INDEX_MAP)
+        pixels = led_matrix->getPixels();
+
+        _buildPixelIndex();
+    #endif /* GAME_PIXEL_INDEX_MAP */
+
+    _updatePalette();
+
+    led_matrix->fillScreen(0);
     led_matrix->show();
 
+    next_tick = millis();
+
+    #if (GAME_DRAW_EFFECT_WIPE)
+        wipe_last_ms = millis();
+    #endif /* GAME_DRAW_EFFECT_WIPE */
+
     // i_col = i_row = 3;
     // if (width == height) {
     //     i_col = width / 2;
@@ -290,65 +946,314 @@ void Game::init() {
  */
 void Game::update() { }
 
-/**
- * Set new round
- */
-void Game::_newRound() {
-    board->reset();
+#if (GAME_PIXEL_INDEX_MAP)
+    /**
+     * Fill `pixel_index` with the strip index of every LED. Same layout math
+     * as Adafruit_NeoMatrix::drawPixel for GAME_NEO_MATRIX_TYPE, done once.
+     */
+    void Game::_buildPixelIndex() {
+        uint8_t corner;
+        uint8_t x;
+        uint8_t y;
+        uint16_t minor;
+        uint16_t major;
+        uint16_t major_scale;
+        uint16_t swap;
+        uint16_t tile;
+        uint16_t pixel;
+
+        for (i_row = 0; i_row < display_height; i_row++) {
+            for (i_col = 0; i_col < display_width; i_col++) {
+                corner = (GAME_NEO_MATRIX_TYPE) & NEO_MATRIX_CORNER;
 
-    #if (GAME_COUNT_MOVES)
-        number_of_rounds_running = 0;
-    #endif /* GAME_COUNT_MOVES */
-}
+                /**
+                 * Tile the cell is in, row major unless tiled by columns
+                 */
+                minor = i_col / matrix_width;
+                major = i_row / matrix_height;
+                x = i_col - minor * matrix_width;
+                y = i_row - major * matrix_height;
+
+                if ((GAME_NEO_MATRIX_TYPE) & NEO_TILE_RIGHT)  minor = tiles_x - 1 - minor;
+                if ((GAME_NEO_MATRIX_TYPE) & NEO_TILE_BOTTOM) major = tiles_y - 1 - major;
+
+                if (((GAME_NEO_MATRIX_TYPE) & NEO_TILE_AXIS) == NEO_TILE_ROWS) major_scale = tiles_x;
+                else {
+                    swap = major;
+                    major = minor;
+                    minor = swap;
+                    major_scale = tiles_y;
+                }
 
-#if (GAME_DRAW_MODE_SPIRAL)
-    /**
-     * Draw an individual cell in the grid for spiral. Should only be called if
-     * GAME_DRAW_EFFECT_PER_CELL is true
-     *
-     * @param  {uint8_t} x  x coordiante
-     * @param  {uint8_t} y  y coordiante
-     */
-    void Game::_drawSpiralCell(uint8_t x, uint8_t y) {
-        #if (GAME_DRAW_EFFECT_WIPE && GAME_DRAW_EFFECT_PER_CELL)
-            #if (GAME_DRAW_EFFECT_DRAW_MARKER)
-                led_matrix->drawPixel(x, y, colors[CELL_STATE_WIPE]);
-                led_matrix->show();
+                /**
+                 * Zigzag tiles flip the corner the matrix starts from
+                 */
+                if (((GAME_NEO_MATRIX_TYPE) & NEO_TILE_SEQUENCE) == NEO_TILE_ZIGZAG && (major & 1)) {
+                    corner ^= NEO_MATRIX_CORNER;
+                    tile = (major + 1) * major_scale - 1 - minor;
+                }
+                else tile = major * major_scale + minor;
 
-                #if (GAME_DRAW_EFFECT_WIPE_DELAY > 0)
-                    delay(GAME_DRAW_EFFECT_WIPE_DELAY);
-                #endif /* GAME_DRAW_EFFECT_WIPE_DELAY > 0 */
-            #endif /* GAME_DRAW_EFFECT_DRAW_MARKER */
+                /**
+                 * Pixel within the tile
+                 */
+                minor = x;
+                major = y;
+
+                if (corner & NEO_MATRIX_RIGHT)  minor = matrix_width - 1 - minor;
+                if (corner & NEO_MATRIX_BOTTOM) major = matrix_height - 1 - major;
+
+                if (((GAME_NEO_MATRIX_TYPE) & NEO_MATRIX_AXIS) == NEO_MATRIX_ROWS) major_scale = matrix_width;
+                else {
+                    swap = major;
+                    major = minor;
+                    minor = swap;
+                    major_scale = matrix_height;
+                }
 
-            led_matrix->drawPixel(x, y, colors[board->getState(x, y)]);
+                if (((GAME_NEO_MATRIX_TYPE) & NEO_MATRIX_SEQUENCE) == NEO_MATRIX_ZIGZAG && (major & 1)) {
+                    pixel = (major + 1) * major_scale - 1 - minor;
+                }
+                else pixel = major * major_scale + minor;
 
-            #if (!GAME_DRAW_EFFECT_DRAW_MARKER)
-                led_matrix->show();
-            #endif /* !GAME_DRAW_EFFECT_DRAW_MARKER */
-        #elif (GAME_DRAW_EFFECT_WIPE)
-            led_matrix->drawPixel(x, y, colors[CELL_STATE_WIPE]);
+                pixel_index[(uint16_t)i_row * display_width + i_col] = tile * matrix_width * matrix_height + pixel;
+            }
+        }
+    }
+#endif /* GAME_PIXEL_INDEX_MAP */
 
-            led_matrix->show();
+/**
+ * Rotate `color` round the hue circle by `palette_hue`, 256 being a full turn.
+ * Red, green and blue are cycled a third of a turn at a time and blended in
+ * between, so greys stay grey.
+ *
+ * @param  {uint32_t} color  24-bit color
+ * @return {uint32_t}        rotated color
+ */
+uint32_t Game::_rotateColor(uint32_t color) const {
+    uint8_t channels[3] = {(uint8_t)(color >> 16), (uint8_t)(color >> 8), (uint8_t)color};
+    uint8_t rotated[3];
+    uint16_t turn = (uint16_t)palette_hue * 3;
+    uint8_t sector = turn >> 8;
+    uint8_t fraction = turn & 0xFF;
+
+    if (palette_hue == 0) return color;
+
+    for (uint8_t i_channel = 0; i_channel < 3; i_channel++) {
+        rotated[i_channel] = (
+            (uint16_t)channels[(i_channel + 3 - sector) % 3] * (256 - fraction) +
+            (uint16_t)channels[(i_channel + 2 - sector) % 3] * fraction
+        ) >> 8;
+    }
+
+    return (color & 0xFF000000) | ((uint32_t)rotated[0] << 16) | ((uint32_t)rotated[1] << 8) | rotated[2];
+}
+
+/**
+ * Work out what each state, and each intensity level when zoomed out, draws
+ * as, with the palette rotation, gamma and, if writing the strip directly,
+ * brightness and color order baked in. Must be called whenever `colors`
+ * change.
+ */
+void Game::_updatePalette() {
+    uint8_t state;
+    uint32_t color;
+
+    #if (GAME_ZOOM_MAX > 1)
+        uint8_t level;
+        uint8_t i_channel;
+    #endif /* GAME_ZOOM_MAX */
+    uint8_t red;
+    uint8_t green;
+    uint8_t blue;
+    uint8_t white;
+
+    #if (GAME_PIXEL_INDEX_MAP)
+        /**
+         * Same scaling as Adafruit_NeoPixel, which stores brightness + 1 so
+         * that full brightness wraps to 0 and is skipped
+         */
+        uint8_t scale = brightness + 1;
+        uint8_t * bytes;
+    #endif /* GAME_PIXEL_INDEX_MAP */
+
+    for (state = 0; state < GAME_PALETTE_SIZE; state++) {
+        if (state <= CELL_STATE_MAX) color = _rotateColor(colors[state]);
+
+        #if (GAME_ZOOM_MAX > 1)
+            else {
+                /**
+                 * Blend from dead to alive before gamma, so levels look evenly
+                 * spaced
+                 */
+                level = state - (CELL_STATE_MAX + 1);
+                color = 0;
+
+                for (i_channel = 0; i_channel < 32; i_channel += 8) {
+                    color |= (uint32_t)(
+                        (
+                            (uint16_t)((colors[CELL_STATE_DEAD] >> i_channel) & 0xFF) * (GAME_ZOOM_LEVELS - level) +
+                            (uint16_t)((colors[CELL_STATE_ALIVE] >> i_channel) & 0xFF) * level
+                        ) / GAME_ZOOM_LEVELS
+                    ) << i_channel;
+                }
+
+                color = _rotateColor(color);
+            }
+        #endif /* GAME_ZOOM_MAX */
+
+        white = color >> 24;
+        red = color >> 16;
+        green = color >> 8;
+        blue = color;
+
+        #if (GAME_PALETTE_GAMMA)
+            white = Adafruit_NeoPixel::gamma8(white);
+            red = Adafruit_NeoPixel::gamma8(red);
+            green = Adafruit_NeoPixel::gamma8(green);
+            blue = Adafruit_NeoPixel::gamma8(blue);
+        #endif /* GAME_PALETTE_GAMMA */
+
+        #if (GAME_PIXEL_INDEX_MAP)
+            if (scale) {
+                white = (white * scale) >> 8;
+                red = (red * scale) >> 8;
+                green = (green * scale) >> 8;
+                blue = (blue * scale) >> 8;
+            }
+
+            bytes = pixel_bytes + state * GAME_PIXEL_BYTES;
+
+            bytes[((GAME_NEO_PIXEL_TYPE) >> 4) & 3] = red;
+            bytes[((GAME_NEO_PIXEL_TYPE) >> 2) & 3] = green;
+            bytes[(GAME_NEO_PIXEL_TYPE) & 3] = blue;
 
-            #if (GAME_DRAW_EFFECT_WIPE_DELAY > 0)
-                delay(GAME_DRAW_EFFECT_WIPE_DELAY);
-            #endif /* GAME_DRAW_EFFECT_WIPE_DELAY > 0 */
+            if (GAME_PIXEL_BYTES == 4) bytes[((GAME_NEO_PIXEL_TYPE) >> 6) & 3] = white;
         #else
-            led_matrix->drawPixel(x, y, colors[board->getState(x, y)]);
-        #endif /* GAME_DRAW_EFFECT_WIPE && GAME_DRAW_EFFECT_PER_CELL*/
+            pixel_colors[state] = ((uint32_t)white << 24) | ((uint32_t)red << 16) | ((uint32_t)green << 8) | blue;
+        #endif /* GAME_PIXEL_INDEX_MAP */
     }
-#endif
+}
 
 /**
- * Draw board
+ * Draw LED `x`, `y` in the color of `state`. Shown on the next `show`.
+ *
+ * @param  {uint8_t} x      x coordiante
+ * @param  {uint8_t} y      y coordiante
+ * @param  {uint8_t} state  state, or above CELL_STATE_MAX an intensity level
  */
-void Game::draw() {
-    #if (GAME_DEBUG)
-        Serial.println("\nMOVE " + String(number_of_rounds_running));
+void Game::_drawPixel(uint8_t x, uint8_t y, uint8_t state) {
+    #if (GAME_PROFILE)
+        game_profile.count(PROFILE_COUNTER_PIXELS, 1);
+    #endif /* GAME_PROFILE */
+
+    #if (GAME_PIXEL_INDEX_MAP)
+        memcpy(
+            pixels + (uint32_t)pixel_index[(uint16_t)y * display_width + x] * GAME_PIXEL_BYTES,
+            pixel_bytes + state * GAME_PIXEL_BYTES,
+            GAME_PIXEL_BYTES
+        );
+    #else
+        led_matrix->setPassThruColor(pixel_colors[state]);
+        led_matrix->drawPixel(x, y, 0);
+        led_matrix->setPassThruColor();
+    #endif /* GAME_PIXEL_INDEX_MAP */
+}
 
-        board->print();
-    #endif /* GAME_DEBUG */
+/**
+ * Draw LED `x`, `y` from the board under it in the viewport. Zoomed out, it
+ * shows how many cells of its block are alive. Off the board is dead.
+ *
+ * @param  {uint8_t} x  x coordiante on the panel
+ * @param  {uint8_t} y  y coordiante on the panel
+ */
+void Game::_drawCell(uint8_t x, uint8_t y) {
+    uint16_t board_x = view_x + (uint16_t)x * zoom;
+    uint16_t board_y = view_y + (uint16_t)y * zoom;
+
+    #if (GAME_ZOOM_MAX > 1)
+        uint8_t num_alive = 0;
+        uint16_t i_board_x;
+        uint16_t i_board_y;
+
+        if (zoom > 1) {
+            for (i_board_y = board_y; i_board_y < board_y + zoom && i_board_y < height; i_board_y++) {
+                for (i_board_x = board_x; i_board_x < board_x + zoom && i_board_x < width; i_board_x++) {
+                    if (board->getState(i_board_x, i_board_y) != CELL_STATE_DEAD) num_alive++;
+                }
+            }
+
+            _drawPixel(x, y, CELL_STATE_MAX + 1 + (uint16_t)num_alive * GAME_ZOOM_LEVELS / (zoom * zoom));
+            return;
+        }
+    #endif /* GAME_ZOOM_MAX */
+
+    if (board_x >= width || board_y >= height) _drawPixel(x, y, CELL_STATE_DEAD);
+    else _drawPixel(x, y, board->getState(board_x, board_y));
+}
+
+/**
+ * Set brightness, redrawing every cell on the next draw
+ *
+ * @param  {uint8_t} _brightness  0 to 255
+ */
+void Game::setBrightness(uint8_t _brightness) {
+    brightness = _brightness;
+
+    led_matrix->setBrightness(brightness);
+    _updatePalette();
+
+    #if (BOARD_TRACK_DIRTY)
+        board->markDirty();
+    #endif /* BOARD_TRACK_DIRTY */
+}
+
+/**
+ * Turn the hue of the palette, redrawing every cell on the next draw. Only the
+ * few palette entries are recomputed, nothing per pixel.
+ *
+ * @param  {uint8_t} hue  amount to turn, 256 being a full turn
+ */
+void Game::rotatePalette(uint8_t hue) {
+    palette_hue += hue;
+
+    _updatePalette();
 
+    #if (BOARD_TRACK_DIRTY)
+        board->markDirty();
+    #endif /* BOARD_TRACK_DIRTY */
+}
+
+/**
+ * Set new round. game_random is seeded for the round before subclasses draw
+ * their soup, so a round plays the same from its seed alone.
+ */
+void Game::_newRound() {
+    board->reset();
+
+    #if (GAME_COUNT_MOVES)
+        number_of_rounds_running = 0;
+    #endif /* GAME_COUNT_MOVES */
+
+    number_of_new_rounds++;
+
+    round_seed = round_random.next();
+    game_random.seed(round_seed);
+
+    #if (GAME_RECORD)
+        recorder.round(number_of_new_rounds, round_seed);
+    #endif /* GAME_RECORD */
+
+    stats.generation = 0;
+    stats.population = 0;
+    stats.births = 0;
+    stats.deaths = 0;
+}
+
+/**
+ * Per frame bookkeeping, count the move and reset if over GAME_MAX_MOVES
+ */
+void Game::_countMove() {
     #if (GAME_COUNT_MOVES)
         number_of_rounds_running++;
 
@@ -362,140 +1267,713 @@ void Game::draw() {
             }
         #endif /* GAME_MAX_MOVES */
     #endif /* GAME_COUNT_MOVES */
+}
+
+/**
+ * Fixed rate scheduler, to be called from `loop` as often as possible. Every
+ * GAME_TICK_MS shows the generation computed on the last tick, then computes
+ * the next one straight away while the LEDs hold the frame, rather than idling
+ * in `delay`. Returns straight away if it is not time yet. If a tick runs late
+ * the schedule restarts from now instead of bursting to catch up.
+ *
+ * @return {bool} truth of a tick having run
+ */
+bool Game::tick() {
+    uint32_t now = millis();
 
+    #if (GAME_PROFILE)
+        uint32_t frame_started;
+        uint32_t update_started;
+    #endif /* GAME_PROFILE */
 
-    #if (GAME_DRAW_CLEAR_ON_REDRAW)
-        for (i_col = 0; i_col < width; i_col++) {
-            for (i_row = 0; i_row < height; i_row++) {
-                led_matrix->drawPixel(i_col, i_row, colors[CELL_STATE_DEAD]);
-            }
+    if ((int32_t)(now - next_tick) < 0) return false;
+
+    next_tick += GAME_TICK_MS;
+    if ((int32_t)(now - next_tick) >= 0) next_tick = now + GAME_TICK_MS;
+
+    #if (GAME_PROFILE)
+        frame_started = GAME_PROFILE_CLOCK();
+    #endif /* GAME_PROFILE */
+
+    draw();
+
+    #if (GAME_PROFILE)
+        update_started = GAME_PROFILE_CLOCK();
+    #endif /* GAME_PROFILE */
+
+    update();
+
+    #if (GAME_RECORD)
+        _recordGeneration();
+    #endif /* GAME_RECORD */
+
+    #if (GAME_PROFILE)
+        game_profile.record(PROFILE_PHASE_UPDATE, GAME_PROFILE_CLOCK() - update_started);
+        game_profile.record(PROFILE_PHASE_FRAME, GAME_PROFILE_CLOCK() - frame_started);
+    #endif /* GAME_PROFILE */
+
+    return true;
+}
+
+/**
+ * Advance up to `generations` without drawing. Stops early if the round ends,
+ * e.g. the board gets stuck, is in a cycle, dies out or hits GAME_MAX_MOVES.
+ * The board is then already set up for the new round.
+ *
+ * @param  {uint16_t} generations   maximum number of generations
+ * @return {uint16_t}               number of generations advanced in the
+ *                                  current round
+ */
+uint16_t Game::advance(uint16_t generations) {
+    uint16_t i_generation;
+    uint16_t number_of_new_rounds_start = number_of_new_rounds;
+
+    for (i_generation = 0; i_generation < generations; i_generation++) {
+        _countMove();
+        if (number_of_new_rounds != number_of_new_rounds_start) break;
+
+        update();
+
+        #if (GAME_RECORD)
+            _recordGeneration();
+        #endif /* GAME_RECORD */
+
+        if (number_of_new_rounds != number_of_new_rounds_start) break;
+    }
+
+    return i_generation;
+}
+
+#if (GAME_RECORD)
+    /**
+     * Hash the board once a generation is computed, every
+     * GAME_RECORD_HASH_INTERVAL of them
+     */
+    void Game::_recordGeneration() {
+        if (stats.generation % GAME_RECORD_HASH_INTERVAL) return;
+
+        recorder.generation(number_of_new_rounds, stats.generation, board->hash());
+    }
+#endif /* GAME_RECORD */
+
+/**
+ * Get strip buffer as last drawn, in the strip's color order with brightness
+ * applied, GAME_PIXEL_BYTES per pixel
+ *
+ * @return {const uint8_t *} pixels
+ */
+const uint8_t * Game::getPixels() {
+    return led_matrix->getPixels();
+}
+
+/**
+ * Get number of pixels in the strip
+ *
+ * @return {uint16_t} number of pixels
+ */
+uint16_t Game::getNumPixels() const {
+    return led_matrix->numPixels();
+}
+
+/**
+ * Get the LED matrix drawn to, e.g. to hook up to a host frame writer
+ *
+ * @return {Adafruit_NeoMatrix *} matrix
+ */
+Adafruit_NeoMatrix * Game::getMatrix() {
+    return led_matrix;
+}
+
+/**
+ * Get the board being simulated
+ *
+ * @return {Board *} board
+ */
+Board * Game::getBoard() {
+    return board;
+}
+
+/**
+ * Get 24-bit color of each state, before palette rotation, gamma and
+ * brightness
+ *
+ * @return {const uint32_t *} colors, CELL_STATE_MAX + 1 of them
+ */
+const uint32_t * Game::getColors() const {
+    return colors;
+}
+
+/**
+ * Get counts for the current round
+ *
+ * @return {const GameStats &} stats
+ */
+const GameStats & Game::getStats() const {
+    return stats;
+}
+
+/**
+ * Get share of the board alive, 255 being every cell
+ *
+ * @return {uint8_t} density
+ */
+uint8_t Game::getDensity() const {
+    return (uint32_t)stats.population * 255 / ((uint16_t)width * height);
+}
+
+/**
+ * Get the seed `init` was given
+ *
+ * @return {uint32_t} seed
+ */
+uint32_t Game::getSeed() const {
+    return round_random.getSeed();
+}
+
+/**
+ * Get the seed of this round, see `_newRound`
+ *
+ * @return {uint32_t} seed
+ */
+uint32_t Game::getRoundSeed() const {
+    return round_seed;
+}
+
+/**
+ * Get the name of the game, as recorded
+ *
+ * @return {const char *} name
+ */
+const char * Game::getName() const {
+    return "game";
+}
+
+/**
+ * Get a hash of the settings that change how a seed plays, so a replay built
+ * differently can tell. Subclasses mix in their own.
+ *
+ * @return {uint32_t} config
+ */
+uint32_t Game::getConfig() const {
+    uint32_t config = 2166136261UL;
+
+    config = _configMix(config, CELLS_PER_BYTE);
+    config = _configMix(config, GAME_COUNT_MOVES);
+    config = _configMix(config, GAME_MAX_MOVES);
+    config = _configMix(config, BOARD_RANDOM_DENSITY);
+    config = _configMix(config, BOARD_RANDOM_SYMMETRY);
+
+    return config;
+}
+
+/**
+ * Mix `value` into `config`, FNV-1a a byte at a time
+ *
+ * @param  {uint32_t} config
+ * @param  {uint32_t} value
+ * @return {uint32_t}         config
+ */
+uint32_t Game::_configMix(uint32_t config, uint32_t value) {
+    for (uint8_t i_byte = 0; i_byte < 4; i_byte++) {
+        config = (config ^ (uint8_t)(value >> (i_byte * 8))) * 16777619UL;
+    }
+
+    return config;
+}
+
+#if (GAME_DRAW_ORDER_TABLE)
+    /**
+     * Fill `draw_order` for `draw_mode`, one of the modes with a table
+     */
+    void Game::_buildDrawOrder() {
+        uint16_t i_position = 0;
+
+        if (draw_mode == GAME_DRAW_MODE_SPIRAL) {
+            _buildSpiralOrder();
+            return;
         }
 
-        led_matrix->show();
-    #endif /* GAME_DRAW_CLEAR_ON_REDRAW */
+        if (draw_mode == GAME_DRAW_MODE_HILBERT) {
+            _buildHilbertOrder();
+            return;
+        }
 
-    #if (GAME_DRAW_MODE == GAME_DRAW_MODE_SPIRAL)
-        spiral_spins = (width / 2) + 1;
-        spiral_width = width;
-        spiral_height = height;
+        for (i_col = 0; i_col < display_width; i_col++) {
+            for (i_row = 0; i_row < display_height; i_row++) {
+                if (i_col & 1) {
+                    draw_order[i_position++] = ((uint16_t)i_col << 8) | (display_height - 1 - i_row);
+                }
+                else {
+                    draw_order[i_position++] = ((uint16_t)i_col << 8) | i_row;
+                }
+            }
+        }
+    }
+
+    /**
+     * Fill `draw_order` clockwise from the top left corner inwards. Walks a
+     * side until its end, then turns and pulls in the side it just left, so
+     * works for any width and height.
+     */
+    void Game::_buildSpiralOrder() {
+        uint16_t num_cells = (uint16_t)display_width * display_height;
+        uint8_t direction = 0;
+        uint8_t left = 0;
+        uint8_t right = display_width - 1;
+        uint8_t top = 0;
+        uint8_t bottom = display_height - 1;
 
         i_col = 0;
         i_row = 0;
 
-        for (i_spiral_spin = 0; i_spiral_spin < spiral_spins; i_spiral_spin++) {
-            for (i_col = max(width - spiral_width - 1, 0); i_col < spiral_width; i_col++) {
+        for (uint16_t i_position = 0; i_position < num_cells; i_position++) {
+            draw_order[i_position] = ((uint16_t)i_col << 8) | i_row;
 
-                /**
-                 * Up
-                 */
-                if (i_spiral_spin != 0) _drawSpiralCell(i_col, i_row);
+            if (direction == 0) {
+                if (i_col < right) i_col++;
+                else {
+                    top++;
+                    direction = 1;
+                    i_row++;
+                }
+            }
+            else if (direction == 1) {
+                if (i_row < bottom) i_row++;
+                else {
+                    right--;
+                    direction = 2;
+                    i_col--;
+                }
+            }
+            else if (direction == 2) {
+                if (i_col > left) i_col--;
+                else {
+                    bottom--;
+                    direction = 3;
+                    i_row--;
+                }
+            }
+            else {
+                if (i_row > top) i_row--;
+                else {
+                    left++;
+                    direction = 0;
+                    i_col++;
+                }
+            }
+        }
+    }
 
-                /**
-                 * Right
-                 */
-                if (i_col == spiral_width - 1) {
-                    for (i_row = height - spiral_height; i_row < spiral_height; i_row++) {
-                        _drawSpiralCell(i_col, i_row);
+    /**
+     * Fill `draw_order` along a Hilbert curve over the smallest power of two
+     * square covering the panel, skipping cells off the panel
+     */
+    void Game::_buildHilbertOrder() {
+        uint16_t side = 1;
+        uint16_t i_position = 0;
+        uint16_t x;
+        uint16_t y;
+        uint16_t swap;
+        uint16_t i_scale;
+        uint32_t remaining;
+        uint8_t rotate_x;
+        uint8_t rotate_y;
+
+        while (side < display_width || side < display_height) side <<= 1;
+
+        for (uint32_t i_curve = 0; i_curve < (uint32_t)side * side; i_curve++) {
+            x = 0;
+            y = 0;
+            remaining = i_curve;
+
+            for (i_scale = 1; i_scale < side; i_scale <<= 1) {
+                rotate_x = 1 & (remaining / 2);
+                rotate_y = 1 & (remaining ^ rotate_x);
+
+                if (rotate_y == 0) {
+                    if (rotate_x == 1) {
+                        x = i_scale - 1 - x;
+                        y = i_scale - 1 - y;
                     }
+
+                    swap = x;
+                    x = y;
+                    y = swap;
                 }
+
+                x += i_scale * rotate_x;
+                y += i_scale * rotate_y;
+                remaining /= 4;
             }
 
-            i_row--;
-            i_col--;
+            if (x < display_width && y < display_height) {
+                draw_order[i_position++] = (x << 8) | y;
+            }
+        }
+    }
+#endif /* GAME_DRAW_ORDER_TABLE */
+
+/**
+ * Set `i_col` and `i_row` to the LED at `i_position` in draw order
+ *
+ * @param  {uint16_t} i_position  0 to number of LEDs - 1
+ */
+void Game::_drawOrderCell(uint16_t i_position) {
+    #if (GAME_DRAW_ORDER_TABLE)
+        if (_drawModeHasTable(draw_mode)) {
+            i_col = draw_order[i_position] >> 8;
+            i_row = draw_order[i_position] & 0xFF;
+            return;
+        }
+    #endif /* GAME_DRAW_ORDER_TABLE */
+
+    if (draw_mode == GAME_DRAW_MODE_ROW_WISE) {
+        i_col = i_position % display_width;
+        i_row = i_position / display_width;
+    }
+    else {
+        i_col = i_position / display_height;
+        i_row = i_position % display_height;
+    }
+}
+
+/**
+ * Truth of `mode` being drawn from the `draw_order` table rather than worked
+ * out from the position
+ *
+ * @param  {uint8_t} mode  one of GAME_DRAW_MODE_*
+ * @return {bool}
+ */
+bool Game::_drawModeHasTable(uint8_t mode) {
+    return mode == GAME_DRAW_MODE_SPIRAL
+        || mode == GAME_DRAW_MODE_SERPENTINE
+        || mode == GAME_DRAW_MODE_HILBERT;
+}
+
+#if (GAME_DRAW_EFFECT_WIPE)
+    /**
+     * Move the wipe on by however many lines are due since it last moved. Each
+     * line it leaves is drawn as the board is now, each line it reaches is
+     * drawn as the marker. Draws nothing if no line is due yet.
+     *
+     * @return {bool} truth of the wipe moving
+     */
+    bool Game::_advanceWipe() {
+        uint16_t num_cells = (uint16_t)display_width * display_height;
+        uint32_t num_steps = 1;
+        uint16_t i_position;
+
+        #if (GAME_DRAW_EFFECT_WIPE_DELAY > 0)
+            uint32_t now = millis();
+
+            num_steps = (now - wipe_last_ms) / GAME_DRAW_EFFECT_WIPE_DELAY;
+            if (num_steps == 0) return false;
+
+            wipe_last_ms += num_steps * GAME_DRAW_EFFECT_WIPE_DELAY;
 
             /**
-             * Down
+             * Fell far behind, one lap redraws everything anyway
              */
-            for (; i_col > width - spiral_width; i_col--) {
-                _drawSpiralCell(i_col, i_row);
+            if (num_steps > num_cells / wipe_line) {
+                num_steps = num_cells / wipe_line;
+                wipe_last_ms = now;
             }
+        #endif /* GAME_DRAW_EFFECT_WIPE_DELAY > 0 */
 
-            /**
-             * Left
-             */
-            for (; i_row > height - spiral_height; i_row--) {
-                _drawSpiralCell(i_col, i_row);
+        for (; num_steps > 0; num_steps--) {
+            for (i_position = wipe_position; i_position < wipe_position + wipe_line; i_position++) {
+                _drawOrderCell(i_position);
+                _drawCell(i_col, i_row);
             }
 
-            spiral_width--;
-            spiral_height--;
-        }
+            wipe_position += wipe_line;
+            if (wipe_position >= num_cells) wipe_position = 0;
 
-        #if (GAME_DRAW_EFFECT_WIPE && !GAME_DRAW_EFFECT_PER_CELL)
-            for (i_col = 0; i_col < width; i_col++) {
-                for (i_row = 0; i_row < height; i_row++) {
-                    led_matrix->drawPixel(i_col, i_row, colors[board->getState(i_col, i_row)]);
+            #if (GAME_DRAW_EFFECT_DRAW_MARKER)
+                for (i_position = wipe_position; i_position < wipe_position + wipe_line; i_position++) {
+                    _drawOrderCell(i_position);
+                    _drawPixel(i_col, i_row, CELL_STATE_WIPE);
                 }
-            }
-        #endif /* GAME_DRAW_EFFECT_WIPE && !GAME_DRAW_EFFECT_PER_CELL */
+            #endif /* GAME_DRAW_EFFECT_DRAW_MARKER */
+        }
+
+        return true;
+    }
+#endif /* GAME_DRAW_EFFECT_WIPE */
+
+/**
+ * Change the order the board is drawn in, restarting any wipe. Modes that
+ * need a table are drawn in the default order without GAME_DRAW_ORDER_TABLE.
+ *
+ * @param  {uint8_t} mode  one of GAME_DRAW_MODE_*
+ */
+void Game::setDrawMode(uint8_t mode) {
+    #if (GAME_DRAW_ORDER_TABLE)
+        draw_mode = mode;
+
+        if (_drawModeHasTable(draw_mode)) _buildDrawOrder();
     #else
+        draw_mode = _drawModeHasTable(mode) ? GAME_DRAW_MODE_DEFAULT : mode;
+    #endif /* GAME_DRAW_ORDER_TABLE */
+
+    #if (GAME_DRAW_EFFECT_WIPE)
+        wipe_position = 0;
 
-        #if (GAME_DRAW_MODE == GAME_DRAW_MODE_ROW_WISE)
-        for (i_row = 0; i_row < height; i_row++) {
+        #if (GAME_DRAW_EFFECT_PER_CELL)
+            wipe_line = 1;
         #else
-        for (i_col = 0; i_col < width; i_col++) {
-        #endif /* GAME_DRAW_MODE_ROW_WISE */
-            /**
-             * If we want to wipe, set all in row to visible
-             */
-            #if (GAME_DRAW_EFFECT_WIPE)
-                #if (GAME_DRAW_MODE == GAME_DRAW_MODE_ROW_WISE)
-                for (i_col = 0; i_col < width; i_col++) {
-                #else
-                for (i_row = 0; i_row < height; i_row++) {
-                #endif /* GAME_DRAW_MODE_ROW_WISE */
-
-                    #if (GAME_DRAW_EFFECT_PER_CELL)
-                        #if (GAME_DRAW_EFFECT_DRAW_MARKER)
-                            led_matrix->drawPixel(i_col, i_row, colors[CELL_STATE_WIPE]);
-                        #endif /* GAME_DRAW_EFFECT_DRAW_MARKER */
-
-                        #if (GAME_DRAW_MODE == GAME_DRAW_MODE_ROW_WISE)
-                        if (i_col > 0) led_matrix->drawPixel(i_col - 1, i_row, colors[board->getState(i_col, i_row)]);
-                        #else
-                        if (i_row > 0) led_matrix->drawPixel(i_col, i_row - 1, colors[board->getState(i_col, i_row)]);
-                        #endif /* GAME_DRAW_MODE_ROW_WISE */
-
-                        led_matrix->show();
-
-                        #if (GAME_DRAW_EFFECT_WIPE_DELAY > 0)
-                            delay(GAME_DRAW_EFFECT_WIPE_DELAY);
-                        #endif /* GAME_DRAW_EFFECT_WIPE_DELAY > 0 */
-
-                    #elif (GAME_DRAW_EFFECT_DRAW_MARKER)
-                        led_matrix->drawPixel(i_col, i_row, colors[CELL_STATE_WIPE]);
-                    #endif /* GAME_DRAW_EFFECT_PER_CELL */
-                }
+            if (draw_mode == GAME_DRAW_MODE_DEFAULT || draw_mode == GAME_DRAW_MODE_SERPENTINE) {
+                wipe_line = display_height;
+            }
+            else if (draw_mode == GAME_DRAW_MODE_ROW_WISE) {
+                wipe_line = display_width;
+            }
+            else {
+                wipe_line = 1;
+            }
+        #endif /* GAME_DRAW_EFFECT_PER_CELL */
+    #endif /* GAME_DRAW_EFFECT_WIPE */
+}
 
-                /**
-                 * Don't want to delay twice for last cell
-                 */
-                #if (!GAME_DRAW_EFFECT_PER_CELL)
-                    led_matrix->show();
+/**
+ * Get the order the board is drawn in
+ *
+ * @return {uint8_t} one of GAME_DRAW_MODE_*
+ */
+uint8_t Game::getDrawMode() const {
+    return draw_mode;
+}
 
-                    #if (GAME_DRAW_EFFECT_WIPE_DELAY > 0)
-                        delay(GAME_DRAW_EFFECT_WIPE_DELAY);
-                    #endif /* GAME_DRAW_EFFECT_WIPE_DELAY > 0 */
-                #endif /* !GAME_DRAW_EFFECT_PER_CELL */
+/**
+ * Draw board, calling `show` at most once
+ */
+void Game::draw() {
+    #if (GAME_PROFILE)
+        uint32_t draw_started;
+        uint32_t show_started;
 
-            #endif /* GAME_DRAW_EFFECT_WIPE */
+        /**
+         * A frame runs from one draw to the next
+         */
+        game_profile.endFrame();
 
-            /**
-             * Draw cell
-             */
+        draw_started = GAME_PROFILE_CLOCK();
+    #endif /* GAME_PROFILE */
+
+    #if (GAME_DEBUG)
+        Serial.println("\nMOVE " + String(number_of_rounds_running));
+
+        board->print();
+    #endif /* GAME_DEBUG */
+
+    _countMove();
 
-            #if (GAME_DRAW_MODE == GAME_DRAW_MODE_ROW_WISE)
-            for (i_col = 0; i_col < width; i_col++) {
-            #else
-            for (i_row = 0; i_row < height; i_row++) {
-            #endif /* GAME_DRAW_MODE_ROW_WISE */
-                led_matrix->drawPixel(i_col, i_row, colors[board->getState(i_col, i_row)]);
+    #if (GAME_PALETTE_ROTATE > 0)
+        rotatePalette(GAME_PALETTE_ROTATE);
+    #endif /* GAME_PALETTE_ROTATE */
+
+    /**
+     * Before drawing, which may clear the dirty marks it looks at
+     */
+    #if (GAME_SERIAL_MIRROR)
+        serial_mirror->send();
+    #endif /* GAME_SERIAL_MIRROR */
+
+    #if (GAME_DRAW_CLEAR_ON_REDRAW)
+        for (i_col = 0; i_col < display_width; i_col++) {
+            for (i_row = 0; i_row < display_height; i_row++) {
+                _drawPixel(i_col, i_row, CELL_STATE_DEAD);
             }
         }
 
-    #endif /* GAME_DRAW_MODE */
+        led_matrix->show();
+    #endif /* GAME_DRAW_CLEAR_ON_REDRAW */
+
+    #if (GAME_DRAW_DIRTY_ONLY)
+        if (view_moved) _drawAll();
+        else if (!_drawDirty()) {
+            #if (GAME_PROFILE)
+                game_profile.record(PROFILE_PHASE_DRAW, GAME_PROFILE_CLOCK() - draw_started);
+            #endif /* GAME_PROFILE */
+
+            return;
+        }
+    #elif (GAME_DRAW_EFFECT_WIPE)
+        if (!_advanceWipe()) {
+            #if (GAME_PROFILE)
+                game_profile.record(PROFILE_PHASE_DRAW, GAME_PROFILE_CLOCK() - draw_started);
+            #endif /* GAME_PROFILE */
+
+            return;
+        }
+    #else
+        _drawAll();
+    #endif /* GAME_DRAW_DIRTY_ONLY */
+
+    view_moved = false;
+
+    #if (BOARD_TRACK_DIRTY)
+        board->clearDirty();
+    #endif /* BOARD_TRACK_DIRTY */
+
+    #if (GAME_PROFILE)
+        show_started = GAME_PROFILE_CLOCK();
+        game_profile.record(PROFILE_PHASE_DRAW, show_started - draw_started);
+    #endif /* GAME_PROFILE */
 
     led_matrix->show();
+
+    #if (GAME_PROFILE)
+        game_profile.record(PROFILE_PHASE_SHOW, GAME_PROFILE_CLOCK() - show_started);
+    #endif /* GAME_PROFILE */
+}
+
+/**
+ * Draw every LED, in draw order
+ */
+void Game::_drawAll() {
+    for (uint16_t i_position = 0; i_position < (uint16_t)display_width * display_height; i_position++) {
+        _drawOrderCell(i_position);
+        _drawCell(i_col, i_row);
+    }
+}
+
+#if (GAME_DRAW_DIRTY_ONLY)
+    /**
+     * Redraw the LEDs over the dirty span of each row of blocks in view.
+     * Clears the dirty marks if there was nothing in view to draw.
+     *
+     * @return {bool} truth of any LED drawn
+     */
+    bool Game::_drawDirty() {
+        uint16_t dirty_min;
+        uint16_t dirty_max;
+        uint16_t board_y;
+        uint16_t i_board_y;
+        uint16_t view_right = view_x + (uint16_t)display_width * zoom - 1;
+        bool any_drawn = false;
+
+        /**
+         * Nothing changed since the last frame, leave the LEDs as they are
+         */
+        if (!board->isDirty()) return false;
+
+        for (i_row = 0; i_row < display_height; i_row++) {
+            board_y = view_y + (uint16_t)i_row * zoom;
+            dirty_min = 0xFFFF;
+            dirty_max = 0;
+
+            for (i_board_y = board_y; i_board_y < board_y + zoom && i_board_y < height; i_board_y++) {
+                if (board->getDirtyColMin(i_board_y) > board->getDirtyColMax(i_board_y)) continue;
+
+                dirty_min = min(dirty_min, (uint16_t)board->getDirtyColMin(i_board_y));
+                dirty_max = max(dirty_max, (uint16_t)board->getDirtyColMax(i_board_y));
+            }
+
+            if (dirty_min > dirty_max || dirty_max < view_x || dirty_min > view_right) continue;
+
+            dirty_min = dirty_min < view_x ? 0 : (dirty_min - view_x) / zoom;
+            dirty_max = dirty_max > view_right ? display_width - 1 : (dirty_max - view_x) / zoom;
+
+            for (i_col = dirty_min; i_col <= dirty_max; i_col++) _drawCell(i_col, i_row);
+
+            any_drawn = true;
+        }
+
+        /**
+         * Only changed out of view
+         */
+        if (!any_drawn) board->clearDirty();
+
+        return any_drawn;
+    }
+#endif /* GAME_DRAW_DIRTY_ONLY */
+
+/**
+ * Move the viewport so board cell `x`, `y` is at the top left of the panel,
+ * kept within the board. Every LED is redrawn on the next draw.
+ *
+ * @param  {uint8_t} x  board column
+ * @param  {uint8_t} y  board row
+ */
+void Game::setViewport(uint8_t x, uint8_t y) {
+    uint16_t view_width = (uint16_t)display_width * zoom;
+    uint16_t view_height = (uint16_t)display_height * zoom;
+
+    view_x = view_width >= width ? 0 : min((uint16_t)x, (uint16_t)(width - view_width));
+    view_y = view_height >= height ? 0 : min((uint16_t)y, (uint16_t)(height - view_height));
+
+    view_moved = true;
+}
+
+/**
+ * Set how many board cells each LED shows along each side, keeping the top
+ * left of the viewport where it is if it still fits
+ *
+ * @param  {uint8_t} _zoom  1 to GAME_ZOOM_MAX
+ */
+void Game::setZoom(uint8_t _zoom) {
+    zoom = constrain(_zoom, 1, GAME_ZOOM_MAX);
+
+    setViewport(view_x, view_y);
+}
+
+/**
+ * Get board column at the left of the panel
+ *
+ * @return {uint8_t} x
+ */
+uint8_t Game::getViewX() const {
+    return view_x;
+}
+
+/**
+ * Get board row at the top of the panel
+ *
+ * @return {uint8_t} y
+ */
+uint8_t Game::getViewY() const {
+    return view_y;
 }
 
+/**
+ * Get board cells each LED shows along each side
+ *
+ * @return {uint8_t} zoom
+ */
+uint8_t Game::getZoom() const {
+    return zoom;
+}
+
+#if (GAME_SERIAL_MIRROR)
+    /**
+     * Get the serial mirror, e.g. to send it elsewhere than Serial
+     *
+     * @return {SerialMirror *} mirror
+     */
+    SerialMirror * Game::getSerialMirror() {
+        return serial_mirror;
+    }
+#endif /* GAME_SERIAL_MIRROR */
+
+#if (GAME_RECORD)
+    /**
+     * Get the recorder, e.g. to write the session elsewhere
+     *
+     * @return {Recorder *} recorder
+     */
+    Recorder * Game::getRecorder() {
+        return &recorder;
+    }
+#endif /* GAME_RECORD */
+
+#if (GAME_PROFILE)
+    /**
+     * Write the profile to Serial in binary, see Profile.h
+     */
+    void Game::dumpProfile() {
+        game_profile.dump(&Serial);
+    }
+#endif /* GAME_PROFILE */
+
 #endif /* Game_h */
@@ -0,0 +1,210 @@
+#ifndef GameStatic_h
+#define GameStatic_h
+
+/*******************************************************************************
+ *                                  Includes                                   *
+ *******************************************************************************/
+
+#include <Arduino.h>
+#include <Adafruit_NeoMatrix.h>
+
+
+/*******************************************************************************
+ *                               Local Includes                                *
+ *******************************************************************************/
+
+#include "Game.h"
+#include "Boards/BoardStatic.h"
+
+
+/*******************************************************************************
+ *                             Game Static Storage                             *
+ *******************************************************************************/
+
+/**
+ * Matrix, board and tables of a game on `BX` by `BY` matrices of `PW` by `PH`
+ * LEDs, sized as Game sizes them but in members rather than on the heap. A
+ * base of the static games rather than a member, so it is there before Game
+ * is. Only the strip buffer the NeoPixel library allocates is left on the
+ * heap.
+ */
+template <uint8_t PW, uint8_t PH, uint8_t BX, uint8_t BY>
+class GameStaticStorage {
+public:
+    static const uint8_t display_width_static = PW * BX;
+    static const uint8_t display_height_static = PH * BY;
+
+    static const uint8_t width_static = GAME_BOARD_WIDTH ? GAME_BOARD_WIDTH : (uint8_t)(PW * BX * GAME_ZOOM);
+    static const uint8_t height_static = GAME_BOARD_HEIGHT ? GAME_BOARD_HEIGHT : (uint8_t)(PH * BY * GAME_ZOOM);
+
+    static const uint16_t num_leds_static = (uint16_t)display_width_static * display_height_static;
+
+protected:
+    Adafruit_NeoMatrix matrix_static;
+
+    BoardStatic<width_static, height_static> board_static;
+
+    #if (GAME_DRAW_ORDER_TABLE)
+        uint16_t draw_order_static[num_leds_static];
+    #endif /* GAME_DRAW_ORDER_TABLE */
+
+    #if (GAME_PIXEL_INDEX_MAP)
+        uint16_t pixel_index_static[num_leds_static];
+    #endif /* GAME_PIXEL_INDEX_MAP */
+
+    GameStaticStorage(uint8_t pin);
+
+    GameStorage _storage();
+
+    static constexpr SramUsage _sram(uint32_t object, uint32_t game, uint16_t num_blocks);
+};
+
+
+/**
+ * SRAM of a static game `object` big that adds `game` bytes of its own on the
+ * heap in `num_blocks` blocks. Everything else is in the object but the strip
+ * buffer and, with GAME_SERIAL_MIRROR, the mirror.
+ *
+ * @param  {uint32_t} object      sizeof the static game
+ * @param  {uint32_t} game        bytes it allocates
+ * @param  {uint16_t} num_blocks  blocks it allocates
+ * @return {SramUsage}
+ */
+template <uint8_t PW, uint8_t PH, uint8_t BX, uint8_t BY>
+constexpr SramUsage GameStaticStorage<PW, PH, BX, BY>::_sram(uint32_t object, uint32_t game, uint16_t num_blocks) {
+    return SramUsage {
+        width_static,
+        height_static,
+
+        object,
+
+        (uint32_t)num_leds_static * GAME_PIXEL_BYTES,
+
+        0,
+
+        game,
+
+        0,
+
+        #if (GAME_SERIAL_MIRROR)
+            (uint32_t)(sizeof(SerialMirror) + SerialMirror::sramBytes(width_static, height_static)),
+        #else
+            0,
+        #endif /* GAME_SERIAL_MIRROR */
+
+        #if (GAME_PROFILE)
+            (uint32_t)sizeof(Profile),
+        #else
+            0,
+        #endif /* GAME_PROFILE */
+
+        /**
+         * Strip and mirror
+         */
+        (uint16_t)(
+            1
+            + num_blocks
+            #if (GAME_SERIAL_MIRROR)
+                + 1 + SerialMirror::sramBlocks()
+            #endif /* GAME_SERIAL_MIRROR */
+        )
+    };
+}
+
+/**
+ * Init Game Static Storage
+ *
+ * @param  {uint8_t} pin  Pin out on Arduino
+ */
+template <uint8_t PW, uint8_t PH, uint8_t BX, uint8_t BY>
+GameStaticStorage<PW, PH, BX, BY>::GameStaticStorage(uint8_t pin): matrix_static(
+    PW,
+    PH,
+    BX,
+    BY,
+    pin,
+    GAME_NEO_MATRIX_TYPE,
+    GAME_NEO_PIXEL_TYPE
+) { }
+
+/**
+ * Everything Game takes from the storage
+ *
+ * @return {GameStorage}
+ */
+template <uint8_t PW, uint8_t PH, uint8_t BX, uint8_t BY>
+GameStorage GameStaticStorage<PW, PH, BX, BY>::_storage() {
+    GameStorage storage;
+
+    storage.led_matrix = &matrix_static;
+    storage.board = &board_static;
+    #if (GAME_DRAW_ORDER_TABLE)
+        storage.draw_order = draw_order_static;
+    #endif /* GAME_DRAW_ORDER_TABLE */
+
+    #if (GAME_PIXEL_INDEX_MAP)
+        storage.pixel_index = pixel_index_static;
+    #endif /* GAME_PIXEL_INDEX_MAP */
+
+    return storage;
+}
+
+
+/*******************************************************************************
+ *                                 Game Static                                 *
+ *******************************************************************************/
+
+/**
+ * Game on `BX` by `BY` matrices of `PW` by `PH` LEDs with its board and tables
+ * in the object, see GameStaticStorage. As a global it takes no heap but the
+ * strip buffer.
+ */
+template <uint8_t PW, uint8_t PH, uint8_t BX, uint8_t BY>
+class GameStatic : private GameStaticStorage<PW, PH, BX, BY>, public Game {
+public:
+    GameStatic(uint8_t pin);
+
+    static constexpr SramUsage sram();
+
+    static constexpr SramUsage sram(
+        uint8_t num_pixels_width,
+        uint8_t num_pixels_height,
+        uint8_t num_boards_x,
+        uint8_t num_boards_y
+    );
+};
+
+
+/**
+ * SRAM of the game, see Game::sram
+ *
+ * @return {SramUsage}
+ */
+template <uint8_t PW, uint8_t PH, uint8_t BX, uint8_t BY>
+constexpr SramUsage GameStatic<PW, PH, BX, BY>::sram() {
+    return GameStaticStorage<PW, PH, BX, BY>::_sram(sizeof(GameStatic), 0, 0);
+}
+
+/**
+ * SRAM of the game, asked the way the other games are asked. The panel is the
+ * one the game was made for.
+ *
+ * @return {SramUsage}
+ */
+template <uint8_t PW, uint8_t PH, uint8_t BX, uint8_t BY>
+constexpr SramUsage GameStatic<PW, PH, BX, BY>::sram(uint8_t, uint8_t, uint8_t, uint8_t) {
+    return sram();
+}
+
+/**
+ * Init Game Static
+ *
+ * @param  {uint8_t} pin  Pin out on Arduino
+ */
+template <uint8_t PW, uint8_t PH, uint8_t BX, uint8_t BY>
+GameStatic<PW, PH, BX, BY>::GameStatic(uint8_t pin):
+    GameStaticStorage<PW, PH, BX, BY>(pin),
+    Game(PW, PH, BX, BY, this->_storage())
+{ }
+
+#endif /* GameStatic_h */
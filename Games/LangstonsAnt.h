@@ -70,26 +70,70 @@
     #define LANGSTONS_ANT_ANTS_MOVE_IN_PARALLEL 1
 #endif /* LANGSTONS_ANT_ANTS_MOVE_IN_PARALLEL */
 
+/*******************************************************************************
+ *                            Langstons Ant Policy                             *
+ *******************************************************************************/
+
+/**
+ * Settings of a Langston's ant as template parameters, so differently set
+ * games can be built side by side, e.g. in the benchmark. Each defaults to its
+ * setting above, which is still how the sketch sets its game.
+ *
+ *   NUM_ANTS         LANGSTONS_ANT_NUM_ANTS
+ *   PARALLEL         LANGSTONS_ANT_ANTS_MOVE_IN_PARALLEL
+ *   CHECK_SAME       LANGSTONS_ANT_CHECK_ALL_ANTS_SAME
+ *   WRAP             ANT_WRAP_BOARD
+ *   RANDOMIZE_BOARD  LANGSTONS_ANT_RANDOMIZE_BOARD
+ */
+template <
+    uint8_t NUM_ANTS = LANGSTONS_ANT_NUM_ANTS,
+    bool PARALLEL = LANGSTONS_ANT_ANTS_MOVE_IN_PARALLEL,
+    bool CHECK_SAME = LANGSTONS_ANT_CHECK_ALL_ANTS_SAME,
+    bool WRAP = ANT_WRAP_BOARD,
+    bool RANDOMIZE_BOARD = LANGSTONS_ANT_RANDOMIZE_BOARD
+>
+struct LangstonsAntPolicy {
+    static const uint8_t num_ants = NUM_ANTS;
+    static const bool move_in_parallel = PARALLEL;
+    static const bool check_all_ants_same = CHECK_SAME;
+    static const bool wrap_board = WRAP;
+    static const bool randomize_board = RANDOMIZE_BOARD;
+
+    static_assert(NUM_ANTS > 0, "Needs an ant");
+};
+
+
 /*******************************************************************************
  *                                LangstonsAnt                                 *
  *******************************************************************************/
 
-class LangstonsAnt: public Game {
+template <class P = LangstonsAntPolicy<> >
+class LangstonsAntT: public Game {
 private:
     uint8_t i_ant;
-    Ant ** ants;
-    uint8_t * state_cell_ant_on;
+    Ant ants[P::num_ants];
+    uint8_t state_cell_ant_on[P::num_ants];
+
+    bool all_ants_same;
 
-    #if (LANGSTONS_ANT_CHECK_ALL_ANTS_SAME)
-        bool all_ants_same;
-    #endif /* LANGSTONS_ANT_CHECK_ALL_ANTS_SAME */
+    void _init();
 
 protected:
     virtual void _newRound();
     virtual void _turnAnts();
 
+    void _setAntCell(uint8_t state);
+
+    LangstonsAntT(
+        uint8_t num_pixels_width,
+        uint8_t num_pixels_height,
+        uint8_t num_boards_x,
+        uint8_t num_boards_y,
+        const GameStorage & storage
+    );
+
 public:
-    LangstonsAnt(
+    LangstonsAntT(
         uint8_t num_pixels_width,
         uint8_t num_pixels_height,
         uint8_t num_boards_x,
@@ -98,8 +142,48 @@ public:
     );
 
     virtual void update();
+
+    virtual const char * getName() const;
+    virtual uint32_t getConfig() const;
+
+    static constexpr SramUsage sram(
+        uint8_t num_pixels_width,
+        uint8_t num_pixels_height,
+        uint8_t num_boards_x,
+        uint8_t num_boards_y
+    );
 };
 
+/**
+ * Langston's ant set by the settings above
+ */
+typedef LangstonsAntT<> LangstonsAnt;
+
+
+/**
+ * SRAM of Langston's ant on a panel that size, see Game::sram. The ants are
+ * part of the object.
+ *
+ * @param  {uint8_t} num_pixels_width   Width of individual NeoMatrix
+ * @param  {uint8_t} num_pixels_height  Height of individual NeoMatrix
+ * @param  {uint8_t} num_boards_x       Number of boards in X direction
+ * @param  {uint8_t} num_boards_y       Number of boards in Y direction
+ * @return {SramUsage}
+ */
+template <class P>
+constexpr SramUsage LangstonsAntT<P>::sram(
+    uint8_t num_pixels_width,
+    uint8_t num_pixels_height,
+    uint8_t num_boards_x,
+    uint8_t num_boards_y
+) {
+    return Game::sram(num_pixels_width, num_pixels_height, num_boards_x, num_boards_y).withGame(
+        sizeof(LangstonsAntT),
+        0,
+        0
+    );
+}
+
 /**
  * Constructor
  *
@@ -109,7 +193,8 @@ public:
  * @param  {uint8_t} num_boards_y       Number of boards in Y direction
  * @param  {uint8_t} pin                Pin out on Arduino
  */
-LangstonsAnt::LangstonsAnt(
+template <class P>
+LangstonsAntT<P>::LangstonsAntT(
     uint8_t num_pixels_width,
     uint8_t num_pixels_height,
     uint8_t num_boards_x,
@@ -122,62 +207,87 @@ LangstonsAnt::LangstonsAnt(
     num_boards_y,
     pin
 ) {
-    ants = new Ant * [LANGSTONS_ANT_NUM_ANTS];
-    state_cell_ant_on = new uint8_t [LANGSTONS_ANT_NUM_ANTS];
+    _init();
+}
 
-    for(i_ant = 0; i_ant < LANGSTONS_ANT_NUM_ANTS; i_ant++) {
-        ants[i_ant] = new Ant();
+/**
+ * Constructor for a game in storage the caller keeps, see Game
+ *
+ * @param  {uint8_t}             num_pixels_width   Width of individual NeoMatrix
+ * @param  {uint8_t}             num_pixels_height  Height of individual NeoMatrix
+ * @param  {uint8_t}             num_boards_x       Number of boards in X direction
+ * @param  {uint8_t}             num_boards_y       Number of boards in Y direction
+ * @param  {const GameStorage &} storage
+ */
+template <class P>
+LangstonsAntT<P>::LangstonsAntT(
+    uint8_t num_pixels_width,
+    uint8_t num_pixels_height,
+    uint8_t num_boards_x,
+    uint8_t num_boards_y,
+    const GameStorage & storage
+): Game(
+    num_pixels_width,
+    num_pixels_height,
+    num_boards_x,
+    num_boards_y,
+    storage
+) {
+    _init();
+}
+
+/**
+ * Put the ants at the start
+ */
+template <class P>
+void LangstonsAntT<P>::_init() {
+    for(i_ant = 0; i_ant < P::num_ants; i_ant++) {
+        ants[i_ant] = Ant();
         state_cell_ant_on[i_ant] = CELL_STATE_DEAD;
     }
 
-    #if (LANGSTONS_ANT_CHECK_ALL_ANTS_SAME)
-        all_ants_same = true;
-    #endif /* LANGSTONS_ANT_CHECK_ALL_ANTS_SAME */
+    all_ants_same = true;
 }
 
 /**
  * Begin a new round of conway. Reset grid and init colors.
  */
-void LangstonsAnt::_newRound() {
+template <class P>
+void LangstonsAntT<P>::_newRound() {
     Game::_newRound();
 
     #if (ANT_RANDOMIZE)
-        #if (LANGSTONS_ANT_CHECK_ALL_ANTS_SAME)
         all_ants_same = true;
-        while (all_ants_same) {
-        #endif /* LANGSTONS_ANT_CHECK_ALL_ANTS_SAME */
-            for(i_ant = 0; i_ant < LANGSTONS_ANT_NUM_ANTS; i_ant++) {
 
-                #if (LANGSTONS_ANT_CHECK_ALL_ANTS_SAME)
-                    if (LANGSTONS_ANT_NUM_ANTS == 1) all_ants_same = false;
+        do {
+            for(i_ant = 0; i_ant < P::num_ants; i_ant++) {
+
+                if (P::check_all_ants_same) {
+                    if (P::num_ants == 1) all_ants_same = false;
                     else if ((i_ant > 0) && (all_ants_same)) all_ants_same = (
-                        ants[i_ant - 1]->getX() == ants[i_ant]->getX()
+                        ants[i_ant - 1].getX() == ants[i_ant].getX()
                     ) && (
-                        ants[i_ant - 1]->getY() == ants[i_ant]->getY()
+                        ants[i_ant - 1].getY() == ants[i_ant].getY()
                     );
 
                     if (!all_ants_same) break;
-                #endif /* LANGSTONS_ANT_CHECK_ALL_ANTS_SAME */
+                }
 
-                ants[i_ant]->randomize(width, height);
+                ants[i_ant].randomize(width, height);
             }
-
-
-        #if (LANGSTONS_ANT_CHECK_ALL_ANTS_SAME)
-        }
-        #endif /* LANGSTONS_ANT_CHECK_ALL_ANTS_SAME */
+        } while (P::check_all_ants_same && all_ants_same);
     #else
-        #if (LANGSTONS_ANT_CHECK_ALL_ANTS_SAME && GAME_DEBUG)
+        #if (GAME_DEBUG)
 
-            if (LANGSTONS_ANT_NUM_ANTS > 1) {
+            if (P::check_all_ants_same && P::num_ants > 1) {
                 all_ants_same = true;
 
-                for(i_ant = 0; i_ant < LANGSTONS_ANT_NUM_ANTS; i_ant++) {
+                for(i_ant = 0; i_ant < P::num_ants; i_ant++) {
                     if ((i_ant > 0) && (all_ants_same)){
                         all_ants_same = (
-                            ants[i_ant - 1]->getX() == ants[i_ant]->getX()
+                            ants[i_ant - 1].getX() == ants[i_ant].getX()
                         ) && (
-                            ants[i_ant - 1]->getY() == ants[i_ant]->getY()
+                            ants[i_ant - 1].getY() == ants[i_ant].getY()
                         );
 
                         if (!all_ants_same) break;
@@ -187,54 +297,88 @@ void LangstonsAnt::_newRound() {
                 if (all_ants_same) Serial.println("All ants equal");
             }
 
-        #endif /* LANGSTONS_ANT_CHECK_ALL_ANTS_SAME && GAME_DEBUG */
+        #endif /* GAME_DEBUG */
     #endif /* ANT_RANDOMIZE */
 
-    #if (LANGSTONS_ANT_RANDOMIZE_BOARD)
-        board->randomize();
-    #endif /* LANGSTONS_ANT_RANDOMIZE_BOARD */
+    if (P::randomize_board) stats.population = board->randomize();
+}
+
+/**
+ * Get the name of the game, as recorded
+ *
+ * @return {const char *} name
+ */
+template <class P>
+const char * LangstonsAntT<P>::getName() const {
+    return "langstons_ant";
+}
+
+/**
+ * Get a hash of the settings, see Game::getConfig
+ *
+ * @return {uint32_t} config
+ */
+template <class P>
+uint32_t LangstonsAntT<P>::getConfig() const {
+    uint32_t config = Game::getConfig();
+
+    config = _configMix(config, P::num_ants);
+    config = _configMix(config, P::move_in_parallel);
+    config = _configMix(config, P::check_all_ants_same);
+    config = _configMix(config, P::wrap_board);
+    config = _configMix(config, P::randomize_board);
+    config = _configMix(config, ANT_RANDOMIZE);
+
+    return config;
+}
+
+/**
+ * Set the cell under the current ant to `state`, counting it as a birth or
+ * death. Ants sharing a cell set it the same, so only the first one counts.
+ *
+ * @param  {uint8_t} state  CELL_STATE_ALIVE or CELL_STATE_DEAD
+ */
+template <class P>
+void LangstonsAntT<P>::_setAntCell(uint8_t state) {
+    if (board->getState(ants[i_ant].getX(), ants[i_ant].getY()) != state) {
+        if (state == CELL_STATE_ALIVE) {
+            stats.population++;
+            stats.births++;
+        }
+        else {
+            stats.population--;
+            stats.deaths++;
+        }
+    }
+
+    board->setState(ants[i_ant].getX(), ants[i_ant].getY(), state);
 }
 
 /**
  * Turn ants
  */
-void LangstonsAnt::_turnAnts() {
-    for(i_ant = 0; i_ant < LANGSTONS_ANT_NUM_ANTS; i_ant++) {
+template <class P>
+void LangstonsAntT<P>::_turnAnts() {
+    for(i_ant = 0; i_ant < P::num_ants; i_ant++) {
         if (state_cell_ant_on[i_ant] == CELL_STATE_DEAD) {
-            board->setState(
-                ants[i_ant]->getX(),
-                ants[i_ant]->getY(),
-                CELL_STATE_ALIVE
-            );
+            _setAntCell(CELL_STATE_ALIVE);
 
-            ants[i_ant]->turn(false);
+            ants[i_ant].turn(false);
         }
         else if (state_cell_ant_on[i_ant] == CELL_STATE_ALIVE) {
-            board->setState(
-                ants[i_ant]->getX(),
-                ants[i_ant]->getY(),
-                CELL_STATE_DEAD
-            );
+            _setAntCell(CELL_STATE_DEAD);
 
-            ants[i_ant]->turn(true);
+            ants[i_ant].turn(true);
         }
         else if (state_cell_ant_on[i_ant] == CELL_STATE_DEAD_BUT_ANT) {
-            board->setState(
-                ants[i_ant]->getX(),
-                ants[i_ant]->getY(),
-                CELL_STATE_ALIVE
-            );
+            _setAntCell(CELL_STATE_ALIVE);
 
-            ants[i_ant]->turn(false);
+            ants[i_ant].turn(false);
         }
         else if (state_cell_ant_on[i_ant] == CELL_STATE_ALIVE_BUT_ANT) {
-            board->setState(
-                ants[i_ant]->getX(),
-                ants[i_ant]->getY(),
-                CELL_STATE_DEAD
-            );
+            _setAntCell(CELL_STATE_DEAD);
 
-            ants[i_ant]->turn(true);
+            ants[i_ant].turn(true);
         }
         else if (state_cell_ant_on[i_ant] == CELL_STATE_ANT) {
             Serial.println("Should not be ant");
@@ -245,68 +389,81 @@ void LangstonsAnt::_turnAnts() {
 /**
  * Update game
  */
-void LangstonsAnt::update() {
+template <class P>
+void LangstonsAntT<P>::update() {
     #if (GAME_DEBUG)
-        for(i_ant = 0; i_ant < LANGSTONS_ANT_NUM_ANTS; i_ant++)
-            ants[i_ant]->print();
+        for(i_ant = 0; i_ant < P::num_ants; i_ant++)
+            ants[i_ant].print();
     #endif /* GAME_DEBUG */
 
+    stats.generation++;
+    stats.births = 0;
+    stats.deaths = 0;
+
+    #if (GAME_PROFILE)
+        game_profile.count(PROFILE_COUNTER_CELLS, P::num_ants);
+    #endif /* GAME_PROFILE */
+
     _turnAnts();
 
     #if (GAME_DEBUG)
-        for(i_ant = 0; i_ant < LANGSTONS_ANT_NUM_ANTS; i_ant++)
-            ants[i_ant]->print();
+        for(i_ant = 0; i_ant < P::num_ants; i_ant++)
+            ants[i_ant].print();
     #endif /* GAME_DEBUG */
 
     /**
      * Move ants
      */
-    for(i_ant = 0; i_ant < LANGSTONS_ANT_NUM_ANTS; i_ant++) {
-        ants[i_ant]->move(width, height);
+    for(i_ant = 0; i_ant < P::num_ants; i_ant++) {
+        ants[i_ant].move(width, height, P::wrap_board);
 
         state_cell_ant_on[i_ant] = board->getState(
-            ants[i_ant]->getX(),
-            ants[i_ant]->getY()
+            ants[i_ant].getX(),
+            ants[i_ant].getY()
         );
 
-        #if (LANGSTONS_ANT_ANTS_MOVE_IN_PARALLEL)
+        if (P::move_in_parallel) {
             if (state_cell_ant_on[i_ant] == CELL_STATE_DEAD)
                 board->setState(
-                    ants[i_ant]->getX(),
-                    ants[i_ant]->getY(),
+                    ants[i_ant].getX(),
+                    ants[i_ant].getY(),
                     CELL_STATE_DEAD_BUT_ANT
                 );
             else if (state_cell_ant_on[i_ant] == CELL_STATE_ALIVE)
                 board->setState(
-                    ants[i_ant]->getX(),
-                    ants[i_ant]->getY(),
+                    ants[i_ant].getX(),
+                    ants[i_ant].getY(),
                     CELL_STATE_ALIVE_BUT_ANT
                 );
-        #else
+        } else {
             /**
              * Show moved ant
              */
             board->setState(
-                ants[i_ant]->getX(),
-                ants[i_ant]->getY(),
+                ants[i_ant].getX(),
+                ants[i_ant].getY(),
                 CELL_STATE_ANT
             );
-        #endif /* LANGSTONS_ANT_ANTS_MOVE_IN_PARALLEL */
+        }
     }
 
     /**
      * Show as ant if moving in parallel
      */
-    #if (LANGSTONS_ANT_ANTS_MOVE_IN_PARALLEL)
-        for(i_col = 0; i_col < width; i_col++) {
-            for(i_row = 0; i_row < height; i_row++) {
-                if (board->getState(i_col, i_row) == CELL_STATE_DEAD_BUT_ANT)
-                    board->setState(i_col, i_row, CELL_STATE_ANT);
-                else if (board->getState(i_col, i_row) == CELL_STATE_ALIVE_BUT_ANT)
-                    board->setState(i_col, i_row, CELL_STATE_ANT);
-            }
+    if (!P::move_in_parallel) return;
+
+    #if (GAME_PROFILE)
+        game_profile.count(PROFILE_COUNTER_CELLS, (uint16_t)width * height);
+    #endif /* GAME_PROFILE */
+
+    for(i_col = 0; i_col < width; i_col++) {
+        for(i_row = 0; i_row < height; i_row++) {
+            if (board->getState(i_col, i_row) == CELL_STATE_DEAD_BUT_ANT)
+                board->setState(i_col, i_row, CELL_STATE_ANT);
+            else if (board->getState(i_col, i_row) == CELL_STATE_ALIVE_BUT_ANT)
+                board->setState(i_col, i_row, CELL_STATE_ANT);
         }
-    #endif /* LANGSTONS_ANT_ANTS_MOVE_IN_PARALLEL */
+    }
 }
 
 #endif /* LangstonsAnt_h */
@@ -0,0 +1,75 @@
+#ifndef LangstonsAntStatic_h
+#define LangstonsAntStatic_h
+
+/*******************************************************************************
+ *                                  Includes                                   *
+ *******************************************************************************/
+
+#include <Arduino.h>
+
+
+/*******************************************************************************
+ *                               Local Includes                                *
+ *******************************************************************************/
+
+#include "LangstonsAnt.h"
+#include "GameStatic.h"
+
+
+/*******************************************************************************
+ *                            Langstons Ant Static                             *
+ *******************************************************************************/
+
+/**
+ * Langston's ant set by policy `P` on `BX` by `BY` matrices of `PW` by `PH`
+ * LEDs with its board and tables in the object, see GameStatic.h
+ */
+template <uint8_t PW, uint8_t PH, uint8_t BX, uint8_t BY, class P = LangstonsAntPolicy<> >
+class LangstonsAntStatic : private GameStaticStorage<PW, PH, BX, BY>, public LangstonsAntT<P> {
+public:
+    LangstonsAntStatic(uint8_t pin);
+
+    static constexpr SramUsage sram();
+
+    static constexpr SramUsage sram(
+        uint8_t num_pixels_width,
+        uint8_t num_pixels_height,
+        uint8_t num_boards_x,
+        uint8_t num_boards_y
+    );
+};
+
+
+/**
+ * SRAM of the game, see Game::sram. The ants are part of the object.
+ *
+ * @return {SramUsage}
+ */
+template <uint8_t PW, uint8_t PH, uint8_t BX, uint8_t BY, class P>
+constexpr SramUsage LangstonsAntStatic<PW, PH, BX, BY, P>::sram() {
+    return GameStaticStorage<PW, PH, BX, BY>::_sram(sizeof(LangstonsAntStatic), 0, 0);
+}
+
+/**
+ * SRAM of the game, asked the way the other games are asked. The panel is the
+ * one the game was made for.
+ *
+ * @return {SramUsage}
+ */
+template <uint8_t PW, uint8_t PH, uint8_t BX, uint8_t BY, class P>
+constexpr SramUsage LangstonsAntStatic<PW, PH, BX, BY, P>::sram(uint8_t, uint8_t, uint8_t, uint8_t) {
+    return sram();
+}
+
+/**
+ * Init Langstons Ant Static
+ *
+ * @param  {uint8_t} pin  Pin out on Arduino
+ */
+template <uint8_t PW, uint8_t PH, uint8_t BX, uint8_t BY, class P>
+LangstonsAntStatic<PW, PH, BX, BY, P>::LangstonsAntStatic(uint8_t pin):
+    GameStaticStorage<PW, PH, BX, BY>(pin),
+    LangstonsAntT<P>(PW, PH, BX, BY, this->_storage())
+{ }
+
+#endif /* LangstonsAntStatic_h */
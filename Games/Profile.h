@@ -0,0 +1,261 @@
+#ifndef Profile_h
+#define Profile_h
+
+/*******************************************************************************
+ *                                  Includes                                   *
+ *******************************************************************************/
+
+#include <Arduino.h>
+
+
+/*******************************************************************************
+ *                              Profile Settings                               *
+ *******************************************************************************/
+
+/**
+ * Time the phases of every frame and count the work done in them, see
+ * `Profile`. Compiled out entirely when false.
+ */
+#ifndef GAME_PROFILE
+    #define GAME_PROFILE false
+#endif /* GAME_PROFILE */
+
+/**
+ * Clock phases are timed with, in microseconds
+ */
+#ifndef GAME_PROFILE_CLOCK
+    #define GAME_PROFILE_CLOCK micros
+#endif /* GAME_PROFILE_CLOCK */
+
+/**
+ * Histogram buckets per phase, 2 bytes each. Bucket 0 counts durations under
+ * a microsecond, bucket `i` those from 2^(i - 1) up to 2^i and the last one
+ * everything longer, so 16 buckets go up to 16ms.
+ */
+#ifndef GAME_PROFILE_BUCKETS
+    #define GAME_PROFILE_BUCKETS 16
+#endif /* GAME_PROFILE_BUCKETS */
+
+/**
+ * Byte that asks the sketch for a dump when read from Serial
+ */
+#ifndef GAME_PROFILE_DUMP_COMMAND
+    #define GAME_PROFILE_DUMP_COMMAND 'P'
+#endif /* GAME_PROFILE_DUMP_COMMAND */
+
+
+/*******************************************************************************
+ *                           Profile Phases & Counters                         *
+ *******************************************************************************/
+
+/**
+ * A whole `tick`, then the parts of it
+ */
+#define PROFILE_PHASE_FRAME     0
+#define PROFILE_PHASE_UPDATE    1
+#define PROFILE_PHASE_DRAW      2
+#define PROFILE_PHASE_SHOW      3
+#define PROFILE_NUM_PHASES      4
+
+/**
+ * Cells a game step looked at, board reads and writes, and LEDs drawn
+ */
+#define PROFILE_COUNTER_CELLS       0
+#define PROFILE_COUNTER_GET_STATE   1
+#define PROFILE_COUNTER_SET_STATE   2
+#define PROFILE_COUNTER_PIXELS      3
+#define PROFILE_NUM_COUNTERS        4
+
+/**
+ * A dump is, all little endian,
+ *
+ *   "GPRF", version, number of phases, buckets and counters (1 byte each),
+ *   frames (4 bytes), then per phase: count, total and longest microseconds
+ *   (4 bytes each) and the buckets (2 bytes each), then per counter: last
+ *   frame's, most in a frame and total (4 bytes each), then a checksum
+ *   (1 byte) making every byte after "GPRF" add up to 0
+ */
+#define PROFILE_DUMP_VERSION 1
+
+
+#if (GAME_PROFILE)
+
+/*******************************************************************************
+ *                                   Profile                                   *
+ *******************************************************************************/
+
+/**
+ * Duration histograms per phase and work counters per frame, in fixed size
+ * arrays so recording never allocates. Buckets stop counting when full rather
+ * than wrapping.
+ */
+class Profile {
+private:
+    uint32_t phase_counts[PROFILE_NUM_PHASES];
+    uint32_t phase_total_us[PROFILE_NUM_PHASES];
+    uint32_t phase_max_us[PROFILE_NUM_PHASES];
+    uint16_t buckets[PROFILE_NUM_PHASES][GAME_PROFILE_BUCKETS];
+
+    /**
+     * Counts of the frame running, the last one finished, the most in one
+     * frame and since the reset
+     */
+    uint32_t frame_counts[PROFILE_NUM_COUNTERS];
+    uint32_t last_counts[PROFILE_NUM_COUNTERS];
+    uint32_t max_counts[PROFILE_NUM_COUNTERS];
+    uint32_t total_counts[PROFILE_NUM_COUNTERS];
+
+    uint32_t num_frames;
+
+    /**
+     * Running sum of a dump being written
+     */
+    uint8_t checksum;
+
+    void _write(Print * out, uint32_t value, uint8_t num_bytes);
+
+public:
+    Profile();
+
+    void reset();
+
+    void record(uint8_t phase, uint32_t us);
+    void count(uint8_t counter, uint32_t amount);
+    void endFrame();
+
+    void dump(Print * out);
+};
+
+
+/**
+ * Init Profile, empty
+ */
+Profile::Profile() {
+    reset();
+}
+
+/**
+ * Forget everything recorded
+ */
+void Profile::reset() {
+    memset(phase_counts, 0, sizeof(phase_counts));
+    memset(phase_total_us, 0, sizeof(phase_total_us));
+    memset(phase_max_us, 0, sizeof(phase_max_us));
+    memset(buckets, 0, sizeof(buckets));
+
+    memset(frame_counts, 0, sizeof(frame_counts));
+    memset(last_counts, 0, sizeof(last_counts));
+    memset(max_counts, 0, sizeof(max_counts));
+    memset(total_counts, 0, sizeof(total_counts));
+
+    num_frames = 0;
+}
+
+/**
+ * Record a phase taking `us`
+ *
+ * @param  {uint8_t}  phase  PROFILE_PHASE_*
+ * @param  {uint32_t} us     microseconds
+ */
+void Profile::record(uint8_t phase, uint32_t us) {
+    uint8_t i_bucket = 0;
+    uint32_t bound = 1;
+
+    while (i_bucket < GAME_PROFILE_BUCKETS - 1 && us >= bound) {
+        i_bucket++;
+        bound <<= 1;
+    }
+
+    if (buckets[phase][i_bucket] < 0xFFFF) buckets[phase][i_bucket]++;
+
+    phase_counts[phase]++;
+    phase_total_us[phase] += us;
+    if (us > phase_max_us[phase]) phase_max_us[phase] = us;
+}
+
+/**
+ * Count work done in the frame running
+ *
+ * @param  {uint8_t}  counter  PROFILE_COUNTER_*
+ * @param  {uint32_t} amount
+ */
+inline void Profile::count(uint8_t counter, uint32_t amount) {
+    frame_counts[counter] += amount;
+}
+
+/**
+ * Finish the frame running, keeping its counts as the last frame's
+ */
+void Profile::endFrame() {
+    for (uint8_t i_counter = 0; i_counter < PROFILE_NUM_COUNTERS; i_counter++) {
+        last_counts[i_counter] = frame_counts[i_counter];
+        total_counts[i_counter] += frame_counts[i_counter];
+        if (frame_counts[i_counter] > max_counts[i_counter]) max_counts[i_counter] = frame_counts[i_counter];
+
+        frame_counts[i_counter] = 0;
+    }
+
+    num_frames++;
+}
+
+/**
+ * Write `value` little endian, adding it to the checksum
+ *
+ * @param  {Print *}  out
+ * @param  {uint32_t} value
+ * @param  {uint8_t}  num_bytes
+ */
+void Profile::_write(Print * out, uint32_t value, uint8_t num_bytes) {
+    for (uint8_t i_byte = 0; i_byte < num_bytes; i_byte++) {
+        checksum += (uint8_t)value;
+        out->write((uint8_t)value);
+        value >>= 8;
+    }
+}
+
+/**
+ * Write everything recorded in binary, see PROFILE_DUMP_VERSION. Leaves it
+ * recorded.
+ *
+ * @param  {Print *} out  e.g. &Serial
+ */
+void Profile::dump(Print * out) {
+    uint8_t i_phase;
+    uint8_t i_bucket;
+    uint8_t i_counter;
+
+    out->write((const uint8_t *)"GPRF", 4);
+
+    checksum = 0;
+
+    _write(out, PROFILE_DUMP_VERSION, 1);
+    _write(out, PROFILE_NUM_PHASES, 1);
+    _write(out, GAME_PROFILE_BUCKETS, 1);
+    _write(out, PROFILE_NUM_COUNTERS, 1);
+    _write(out, num_frames, 4);
+
+    for (i_phase = 0; i_phase < PROFILE_NUM_PHASES; i_phase++) {
+        _write(out, phase_counts[i_phase], 4);
+        _write(out, phase_total_us[i_phase], 4);
+        _write(out, phase_max_us[i_phase], 4);
+
+        for (i_bucket = 0; i_bucket < GAME_PROFILE_BUCKETS; i_bucket++) _write(out, buckets[i_phase][i_bucket], 2);
+    }
+
+    for (i_counter = 0; i_counter < PROFILE_NUM_COUNTERS; i_counter++) {
+        _write(out, last_counts[i_counter], 4);
+        _write(out, max_counts[i_counter], 4);
+        _write(out, total_counts[i_counter], 4);
+    }
+
+    out->write((uint8_t)-checksum);
+}
+
+/**
+ * The one profile everything records into
+ */
+static Profile game_profile;
+
+#endif /* GAME_PROFILE */
+
+#endif /* Profile_h */
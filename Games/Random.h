@@ -0,0 +1,175 @@
+#ifndef Random_h
+#define Random_h
+
+/*******************************************************************************
+ *                                  Includes                                   *
+ *******************************************************************************/
+
+#include <Arduino.h>
+
+
+/*******************************************************************************
+ *                              Random Settings                                *
+ *******************************************************************************/
+
+/**
+ * Seed of the first round, 0 to take one from the floating analog pins. Set it
+ * to get the same games every start.
+ */
+#ifndef GAME_RANDOM_SEED
+    #define GAME_RANDOM_SEED 0
+#endif /* GAME_RANDOM_SEED */
+
+/**
+ * Analog reads mixed into a seed taken from noise, a few bits of each are
+ * noise at best
+ */
+#ifndef GAME_RANDOM_NOISE_READS
+    #define GAME_RANDOM_NOISE_READS 32
+#endif /* GAME_RANDOM_NOISE_READS */
+
+/**
+ * Analog pins read for noise, A0 up to this one less
+ */
+#ifndef GAME_RANDOM_NOISE_PINS
+    #define GAME_RANDOM_NOISE_PINS 6
+#endif /* GAME_RANDOM_NOISE_PINS */
+
+
+/*******************************************************************************
+ *                                   Random                                    *
+ *******************************************************************************/
+
+/**
+ * Marsaglia's xorshift32. Three shifts and xors of a 32 bit word a number, so
+ * cheap on an AVR, where `random` takes a 32 bit division. Not for anything
+ * but games. The same seed gives the same numbers on every target.
+ */
+class Random {
+private:
+    uint32_t state;
+    uint32_t seed_value;
+
+public:
+    Random(uint32_t _seed = 1);
+
+    void seed(uint32_t _seed);
+    uint32_t getSeed() const;
+
+    static uint32_t noiseSeed();
+
+    uint32_t next();
+    uint32_t below(uint32_t bound);
+    uint32_t bits(uint8_t density);
+};
+
+
+/**
+ * Init Random
+ *
+ * @param  {uint32_t} _seed
+ */
+Random::Random(uint32_t _seed) {
+    seed(_seed);
+}
+
+/**
+ * Start the numbers over from `_seed`. Nearby seeds are scrambled apart, as
+ * xorshift would start them off alike.
+ *
+ * @param  {uint32_t} _seed  any, 0 included
+ */
+void Random::seed(uint32_t _seed) {
+    seed_value = _seed;
+
+    /**
+     * Murmur3's finalizer, which maps only 0 to 0
+     */
+    state = _seed;
+    state ^= state >> 16;
+    state *= 0x85EBCA6BUL;
+    state ^= state >> 13;
+    state *= 0xC2B2AE35UL;
+    state ^= state >> 16;
+
+    if (!state) state = 0x9E3779B9UL;
+}
+
+/**
+ * Seed read from the floating analog pins
+ *
+ * @return {uint32_t} seed
+ */
+uint32_t Random::noiseSeed() {
+    uint32_t noise = 0;
+
+    for (uint8_t i_read = 0; i_read < GAME_RANDOM_NOISE_READS; i_read++) {
+        noise = (noise << 5 | noise >> 27) ^ (uint32_t)analogRead(i_read % GAME_RANDOM_NOISE_PINS);
+    }
+
+    return noise;
+}
+
+/**
+ * Seed last set
+ *
+ * @return {uint32_t} seed
+ */
+uint32_t Random::getSeed() const {
+    return seed_value;
+}
+
+/**
+ * Next number
+ *
+ * @return {uint32_t} any
+ */
+inline uint32_t Random::next() {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+
+    return state;
+}
+
+/**
+ * Next number under `bound`, by the high half of a multiply rather than a
+ * modulo, so no division and no bias worth noting
+ *
+ * @param  {uint32_t} bound  above 0
+ * @return {uint32_t}        0 up to `bound` - 1
+ */
+uint32_t Random::below(uint32_t bound) {
+    return (uint32_t)(((uint64_t)next() * bound) >> 32);
+}
+
+/**
+ * 32 bits each set with a chance of `density` in 256. A bit of `density` at a
+ * time from the lowest set one up, ors in a number for a 1 and ands one in
+ * for a 0, so it takes at most 8 numbers for 32 bits.
+ *
+ * @param  {uint8_t}  density  out of 256
+ * @return {uint32_t}          bits
+ */
+uint32_t Random::bits(uint8_t density) {
+    uint32_t word = 0;
+    uint8_t i_bit = 0;
+
+    if (!density) return 0;
+
+    while (!(density & (1 << i_bit))) i_bit++;
+
+    for (; i_bit < 8; i_bit++) {
+        if (density & (1 << i_bit)) word |= next();
+        else word &= next();
+    }
+
+    return word;
+}
+
+/**
+ * Numbers for the games, seeded by Game::init
+ */
+static Random game_random;
+
+#endif /* Random_h */
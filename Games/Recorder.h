@@ -0,0 +1,159 @@
+#ifndef Recorder_h
+#define Recorder_h
+
+/*******************************************************************************
+ *                                  Includes                                   *
+ *******************************************************************************/
+
+#include <Arduino.h>
+
+
+/*******************************************************************************
+ *                              Recorder Settings                              *
+ *******************************************************************************/
+
+/**
+ * Log the session seed, every round's seed and hashes of the board over
+ * Serial, see Recorder. A session is played again by seeding `init` with the
+ * seed logged, GAME_RANDOM_SEED on the board, and checked with Host/replay.
+ */
+#ifndef GAME_RECORD
+    #define GAME_RECORD false
+#endif /* GAME_RECORD */
+
+/**
+ * Generations between board hashes, 1 for every one. A line is about 20
+ * bytes, so at 9600 baud and 100 generations a second, the sketch's
+ * defaults, keep it to 5 or more or the loop waits on Serial.
+ */
+#ifndef GAME_RECORD_HASH_INTERVAL
+    #define GAME_RECORD_HASH_INTERVAL 5
+#endif /* GAME_RECORD_HASH_INTERVAL */
+
+
+/*******************************************************************************
+ *                                  Recorder                                   *
+ *******************************************************************************/
+
+/**
+ * Writes a session as lines of text, a letter and fields split by spaces,
+ * numbers in decimal but for hex config and hashes
+ *
+ *   S name display_width display_height width height config seed
+ *   R round seed
+ *   G round generation hash
+ *
+ * The session line comes first. `config` is Game::getConfig, so a replay
+ * built with other settings can tell. A round line comes with every new
+ * round, the first one included. `round` counts rounds since the game was
+ * constructed. A generation line hashes the board, see Board::hash, once
+ * `generation` of the round is computed. Anything else in the log, e.g.
+ * GAME_DEBUG output, is not a line of the session.
+ */
+class Recorder {
+private:
+    Print * out;
+
+public:
+    Recorder(Print * _out = &Serial);
+
+    void setOutput(Print * _out);
+
+    void session(
+        const char * name,
+        uint8_t display_width,
+        uint8_t display_height,
+        uint8_t width,
+        uint8_t height,
+        uint32_t config,
+        uint32_t seed
+    );
+    void round(uint16_t i_round, uint32_t seed);
+    void generation(uint16_t i_round, uint16_t generation, uint32_t hash);
+};
+
+
+/**
+ * Init Recorder
+ *
+ * @param  {Print *} _out  e.g. &Serial
+ */
+Recorder::Recorder(Print * _out) {
+    out = _out;
+}
+
+/**
+ * Write to `_out` from now on, e.g. to check a replay as it is written
+ *
+ * @param  {Print *} _out
+ */
+void Recorder::setOutput(Print * _out) {
+    out = _out;
+}
+
+/**
+ * Start of a session
+ *
+ * @param  {const char *} name            Game::getName
+ * @param  {uint8_t}      display_width   LEDs across all matrices
+ * @param  {uint8_t}      display_height
+ * @param  {uint8_t}      width           board
+ * @param  {uint8_t}      height
+ * @param  {uint32_t}     config          Game::getConfig
+ * @param  {uint32_t}     seed            Game::init was given
+ */
+void Recorder::session(
+    const char * name,
+    uint8_t display_width,
+    uint8_t display_height,
+    uint8_t width,
+    uint8_t height,
+    uint32_t config,
+    uint32_t seed
+) {
+    out->print("S ");
+    out->print(name);
+    out->print(' ');
+    out->print(display_width);
+    out->print(' ');
+    out->print(display_height);
+    out->print(' ');
+    out->print(width);
+    out->print(' ');
+    out->print(height);
+    out->print(' ');
+    out->print(config, HEX);
+    out->print(' ');
+    out->println(seed);
+}
+
+/**
+ * Start of a round
+ *
+ * @param  {uint16_t} i_round
+ * @param  {uint32_t} seed     game_random was seeded with for the round
+ */
+void Recorder::round(uint16_t i_round, uint32_t seed) {
+    out->print("R ");
+    out->print(i_round);
+    out->print(' ');
+    out->println(seed);
+}
+
+/**
+ * A generation computed
+ *
+ * @param  {uint16_t} i_round
+ * @param  {uint16_t} generation  of the round
+ * @param  {uint32_t} hash        Board::hash
+ */
+void Recorder::generation(uint16_t i_round, uint16_t generation, uint32_t hash) {
+    out->print("G ");
+    out->print(i_round);
+    out->print(' ');
+    out->print(generation);
+    out->print(' ');
+    out->println(hash, HEX);
+}
+
+#endif /* Recorder_h */
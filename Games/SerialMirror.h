@@ -0,0 +1,572 @@
+#ifndef SerialMirror_h
+#define SerialMirror_h
+
+/*******************************************************************************
+ *                                  Includes                                   *
+ *******************************************************************************/
+
+#include <Arduino.h>
+
+
+/*******************************************************************************
+ *                               Local Includes                                *
+ *******************************************************************************/
+
+#include "Boards/Board.h"
+
+
+/*******************************************************************************
+ *                           Serial Mirror Settings                            *
+ *******************************************************************************/
+
+/**
+ * Frames between keyframes. A receiver that joins late or drops a packet
+ * picks the board up again from the next one.
+ */
+#ifndef SERIAL_MIRROR_KEYFRAME_INTERVAL
+    #define SERIAL_MIRROR_KEYFRAME_INTERVAL 64
+#endif /* SERIAL_MIRROR_KEYFRAME_INTERVAL */
+
+/**
+ * Unchanged cells within a row that still join two changes into one span.
+ * A new span costs 3 bytes, a run of unchanged cells 1 to 2.
+ */
+#ifndef SERIAL_MIRROR_GAP
+    #define SERIAL_MIRROR_GAP 4
+#endif /* SERIAL_MIRROR_GAP */
+
+/**
+ * Skip a frame rather than wait when it doesn't fit in the transmit buffer.
+ * Changes are compared against what was last sent, so they go out with the
+ * next frame that fits.
+ */
+#ifndef SERIAL_MIRROR_SKIP_WHEN_BUSY
+    #define SERIAL_MIRROR_SKIP_WHEN_BUSY true
+#endif /* SERIAL_MIRROR_SKIP_WHEN_BUSY */
+
+/**
+ * Free space `availableForWrite` reports with the transmit buffer empty.
+ * Packets bigger than that only go out once it has drained.
+ */
+#ifndef SERIAL_MIRROR_TX_BUFFER
+    #if defined(SERIAL_TX_BUFFER_SIZE)
+        #define SERIAL_MIRROR_TX_BUFFER (SERIAL_TX_BUFFER_SIZE - 1)
+    #else
+        #define SERIAL_MIRROR_TX_BUFFER 63
+    #endif /* SERIAL_TX_BUFFER_SIZE */
+#endif /* SERIAL_MIRROR_TX_BUFFER */
+
+
+/*******************************************************************************
+ *                           Serial Mirror Protocol                            *
+ *******************************************************************************/
+
+/**
+ * Every packet is
+ *
+ *   sync, type, sequence, width, height (1 byte each), payload length
+ *   (2 bytes, little endian), payload, checksum (1 byte)
+ *
+ * The sequence goes up by one with every packet sent. The checksum is the sum
+ * of every byte from type to the end of the payload, so that all of them plus
+ * the checksum add up to 0.
+ *
+ * States go out as runs, one byte each with the state in the high nibble and
+ * the length less one in the low nibble. A low nibble of 0xF means the length
+ * is 16 plus the next byte. Longer runs are split. States must fit in a
+ * nibble, i.e. CELLS_PER_BYTE of at least 2.
+ *
+ * A keyframe payload is runs over every cell, row by row. A delta payload is
+ * spans of changed cells, each
+ *
+ *   row, first column, number of cells (1 byte each), runs over the span
+ *
+ * and only applies on top of the packet before it. A delta is only sent when
+ * it is smaller than a keyframe, so is always shorter than a byte per cell.
+ */
+#define SERIAL_MIRROR_SYNC      0xA5
+#define SERIAL_MIRROR_KEYFRAME  'K'
+#define SERIAL_MIRROR_DELTA     'D'
+
+#define SERIAL_MIRROR_HEADER_BYTES 7
+#define SERIAL_MIRROR_RUN_MAX   (16 + 255)
+
+
+/*******************************************************************************
+ *                               Serial Mirror                                 *
+ *******************************************************************************/
+
+/**
+ * Mirrors a board over a serial link, sending only the cells that changed
+ * since the last packet. Keeps a copy of the board as last sent to compare
+ * against, so costs one more board of memory. Packets are worked out twice,
+ * once to size them and once to send, rather than buffered.
+ */
+class SerialMirror {
+    static_assert(CELLS_PER_BYTE >= 2, "States are sent in a nibble, needs CELLS_PER_BYTE of at least 2");
+
+private:
+    Board * board;
+    Board * sent;
+    Print * out;
+
+    uint8_t width;
+    uint8_t height;
+
+    uint8_t sequence;
+    uint16_t frames_to_keyframe;
+    bool needs_keyframe;
+
+    uint32_t num_packets;
+    uint32_t num_skipped;
+    uint32_t num_bytes;
+
+    #if (BOARD_TRACK_DIRTY)
+        /**
+         * Dirty columns of each row not sent yet, kept across frames that
+         * were skipped, none if min is past max
+         */
+        uint8_t * pending_col_min;
+        uint8_t * pending_col_max;
+
+        void _collectDirty();
+        void _clearPending();
+    #endif /* BOARD_TRACK_DIRTY */
+
+    /**
+     * Writing out or only counting, bytes put so far and their sum
+     */
+    bool writing;
+    uint32_t length;
+    uint8_t checksum;
+
+    void _put(uint8_t value);
+    void _putRun(uint8_t state, uint16_t count);
+
+    uint32_t _keyframe();
+    uint32_t _delta();
+    bool _spanEnd(uint8_t y, uint8_t x, uint8_t last, uint8_t & end);
+
+public:
+    SerialMirror(Board * _board, Print * _out);
+    ~SerialMirror();
+
+    bool send();
+
+    void setOutput(Print * _out);
+    void requestKeyframe();
+
+    uint32_t getPackets() const;
+    uint32_t getSkipped() const;
+    uint32_t getBytes() const;
+
+    static constexpr uint32_t sramBytes(uint8_t _width, uint8_t _height);
+    static constexpr uint16_t sramBlocks();
+};
+
+
+/**
+ * Heap a mirror of a board allocates, the object itself not included
+ *
+ * @param  {uint8_t} _width   of the board
+ * @param  {uint8_t} _height
+ * @return {uint32_t}          bytes
+ */
+constexpr uint32_t SerialMirror::sramBytes(uint8_t _width, uint8_t _height) {
+    return sizeof(Board) + Board::sramBytes(_width, _height) + (BOARD_TRACK_DIRTY ? 2 * (uint32_t)_height : 0);
+}
+
+/**
+ * Heap blocks a mirror allocates, the object itself not included
+ *
+ * @return {uint16_t} blocks
+ */
+constexpr uint16_t SerialMirror::sramBlocks() {
+    return 1 + Board::sramBlocks() + (BOARD_TRACK_DIRTY ? 2 : 0);
+}
+
+
+/**
+ * Init Serial Mirror, starting with a keyframe
+ *
+ * @param {Board *} board  board to mirror
+ * @param {Print *} out    serial link, e.g. &Serial
+ */
+SerialMirror::SerialMirror(Board * _board, Print * _out) {
+    board = _board;
+    out = _out;
+
+    width = board->getWidth();
+    height = board->getHeight();
+
+    sent = new Board(width, height);
+
+    sequence = 0;
+    frames_to_keyframe = 0;
+    needs_keyframe = true;
+
+    num_packets = 0;
+    num_skipped = 0;
+    num_bytes = 0;
+
+    #if (BOARD_TRACK_DIRTY)
+        pending_col_min = new uint8_t [height];
+        pending_col_max = new uint8_t [height];
+
+        _clearPending();
+    #endif /* BOARD_TRACK_DIRTY */
+}
+
+/**
+ * Free copy of the board
+ */
+SerialMirror::~SerialMirror() {
+    delete sent;
+
+    #if (BOARD_TRACK_DIRTY)
+        delete [] pending_col_min;
+        delete [] pending_col_max;
+    #endif /* BOARD_TRACK_DIRTY */
+}
+
+/**
+ * Send what changed on the board since the last packet, or a keyframe every
+ * SERIAL_MIRROR_KEYFRAME_INTERVAL frames. Call once per frame, before the
+ * board's dirty marks are cleared. Sends nothing if nothing changed.
+ *
+ * @return {bool} truth of a packet being sent
+ */
+bool SerialMirror::send() {
+    uint8_t type;
+    uint32_t payload_length;
+    uint32_t keyframe_length;
+    int available;
+
+    #if (BOARD_TRACK_DIRTY)
+        _collectDirty();
+    #endif /* BOARD_TRACK_DIRTY */
+
+    if (frames_to_keyframe == 0) needs_keyframe = true;
+    else frames_to_keyframe--;
+
+    writing = false;
+    length = 0;
+
+    if (needs_keyframe) {
+        type = SERIAL_MIRROR_KEYFRAME;
+        payload_length = _keyframe();
+    }
+    else {
+        type = SERIAL_MIRROR_DELTA;
+        payload_length = _delta();
+
+        if (payload_length == 0) return false;
+
+        /**
+         * Changed in so many places that a keyframe is no bigger
+         */
+        length = 0;
+        keyframe_length = _keyframe();
+
+        if (keyframe_length <= payload_length) {
+            type = SERIAL_MIRROR_KEYFRAME;
+            payload_length = keyframe_length;
+        }
+    }
+
+    #if (SERIAL_MIRROR_SKIP_WHEN_BUSY)
+        available = out->availableForWrite();
+
+        if (
+            payload_length + SERIAL_MIRROR_HEADER_BYTES + 1 > (uint32_t)available &&
+            available < SERIAL_MIRROR_TX_BUFFER
+        ) {
+            num_skipped++;
+            return false;
+        }
+    #else
+        (void)available;
+    #endif /* SERIAL_MIRROR_SKIP_WHEN_BUSY */
+
+    writing = true;
+    length = 0;
+    checksum = 0;
+
+    out->write(SERIAL_MIRROR_SYNC);
+    _put(type);
+    _put(sequence);
+    _put(width);
+    _put(height);
+    _put(payload_length);
+    _put(payload_length >> 8);
+
+    if (type == SERIAL_MIRROR_KEYFRAME) _keyframe();
+    else _delta();
+
+    out->write((uint8_t)-checksum);
+
+    num_bytes += length + 2;
+    num_packets++;
+    sequence++;
+
+    #if (BOARD_TRACK_DIRTY)
+        _clearPending();
+    #endif /* BOARD_TRACK_DIRTY */
+
+    if (type == SERIAL_MIRROR_KEYFRAME) {
+        needs_keyframe = false;
+        frames_to_keyframe = SERIAL_MIRROR_KEYFRAME_INTERVAL - 1;
+    }
+
+    return true;
+}
+
+/**
+ * Put a byte of the packet, writing it out only on the second pass
+ *
+ * @param  {uint8_t} value
+ */
+void SerialMirror::_put(uint8_t value) {
+    length++;
+
+    if (!writing) return;
+
+    checksum += value;
+    out->write(value);
+}
+
+/**
+ * Put `count` cells of `state` as runs
+ *
+ * @param  {uint8_t}  state
+ * @param  {uint16_t} count  cells
+ */
+void SerialMirror::_putRun(uint8_t state, uint16_t count) {
+    uint16_t run;
+
+    state = (state & 0x0F) << 4;
+
+    while (count > 0) {
+        run = min(count, (uint16_t)SERIAL_MIRROR_RUN_MAX);
+
+        if (run < 16) _put(state | (run - 1));
+        else {
+            _put(state | 0x0F);
+            _put(run - 16);
+        }
+
+        count -= run;
+    }
+}
+
+/**
+ * Put runs over every cell. Also updates the copy when writing.
+ *
+ * @return {uint32_t} payload bytes
+ */
+uint32_t SerialMirror::_keyframe() {
+    uint32_t start = length;
+    uint8_t state;
+    uint8_t run_state = CELL_STATE_DEAD;
+    uint16_t run = 0;
+
+    for (uint8_t y = 0; y < height; y++) {
+        for (uint8_t x = 0; x < width; x++) {
+            state = board->getState(x, y);
+
+            if (writing) sent->setState(x, y, state);
+
+            if (run > 0 && state != run_state) {
+                _putRun(run_state, run);
+                run = 0;
+            }
+
+            run_state = state;
+            run++;
+        }
+    }
+
+    if (run > 0) _putRun(run_state, run);
+
+    return length - start;
+}
+
+/**
+ * Find where the span of changes starting at `x` ends, joining changes up to
+ * SERIAL_MIRROR_GAP cells apart
+ *
+ * @param  {uint8_t}   y
+ * @param  {uint8_t}   x     first column, changed
+ * @param  {uint8_t}   last  last column to look at
+ * @param  {uint8_t &} end   set to the last changed column of the span
+ * @return {bool}            truth of any change left after the span
+ */
+bool SerialMirror::_spanEnd(uint8_t y, uint8_t x, uint8_t last, uint8_t & end) {
+    uint8_t gap = 0;
+
+    end = x;
+
+    while (x < last) {
+        x++;
+
+        if (board->getState(x, y) == sent->getState(x, y)) {
+            gap++;
+            continue;
+        }
+
+        if (gap > SERIAL_MIRROR_GAP) return true;
+
+        end = x;
+        gap = 0;
+    }
+
+    return false;
+}
+
+/**
+ * Put a span for every run of changed cells, only looking at the columns of
+ * each row dirtied since the last packet. Also updates the copy when writing.
+ *
+ * @return {uint32_t} payload bytes
+ */
+uint32_t SerialMirror::_delta() {
+    uint32_t start = length;
+    uint8_t first;
+    uint8_t last;
+    uint8_t x;
+    uint8_t end;
+    uint8_t state;
+    uint8_t run_state;
+    uint16_t run;
+    bool more;
+
+    for (uint8_t y = 0; y < height; y++) {
+        #if (BOARD_TRACK_DIRTY)
+            first = pending_col_min[y];
+            last = pending_col_max[y];
+
+            if (first > last) continue;
+        #else
+            first = 0;
+            last = width - 1;
+        #endif /* BOARD_TRACK_DIRTY */
+
+        x = first;
+
+        /**
+         * Skip to the first change
+         */
+        while (board->getState(x, y) == sent->getState(x, y)) {
+            if (x == last) break;
+            x++;
+        }
+
+        if (board->getState(x, y) == sent->getState(x, y)) continue;
+
+        do {
+            more = _spanEnd(y, x, last, end);
+
+            _put(y);
+            _put(x);
+            _put(end - x + 1);
+
+            run_state = board->getState(x, y);
+            run = 0;
+
+            for (; x <= end; x++) {
+                state = board->getState(x, y);
+
+                if (writing) sent->setState(x, y, state);
+
+                if (state != run_state) {
+                    _putRun(run_state, run);
+                    run = 0;
+                }
+
+                run_state = state;
+                run++;
+            }
+
+            _putRun(run_state, run);
+
+            /**
+             * On to the next change
+             */
+            while (more && board->getState(x, y) == sent->getState(x, y)) x++;
+        } while (more);
+    }
+
+    return length - start;
+}
+
+#if (BOARD_TRACK_DIRTY)
+    /**
+     * Add the board's dirty columns to those not sent yet
+     */
+    void SerialMirror::_collectDirty() {
+        if (!board->isDirty()) return;
+
+        for (uint8_t y = 0; y < height; y++) {
+            if (board->getDirtyColMin(y) > board->getDirtyColMax(y)) continue;
+
+            pending_col_min[y] = min(pending_col_min[y], board->getDirtyColMin(y));
+            pending_col_max[y] = max(pending_col_max[y], board->getDirtyColMax(y));
+        }
+    }
+
+    /**
+     * Forget the dirty columns, once sent
+     */
+    void SerialMirror::_clearPending() {
+        for (uint8_t y = 0; y < height; y++) {
+            pending_col_min[y] = 0xFF;
+            pending_col_max[y] = 0;
+        }
+    }
+#endif /* BOARD_TRACK_DIRTY */
+
+/**
+ * Set where packets go
+ *
+ * @param  {Print *} out  serial link
+ */
+void SerialMirror::setOutput(Print * _out) {
+    out = _out;
+}
+
+/**
+ * Send a keyframe with the next frame, e.g. when a receiver connects
+ */
+void SerialMirror::requestKeyframe() {
+    needs_keyframe = true;
+}
+
+/**
+ * Get number of packets sent
+ *
+ * @return {uint32_t} packets
+ */
+uint32_t SerialMirror::getPackets() const {
+    return num_packets;
+}
+
+/**
+ * Get number of frames skipped as the link was busy
+ *
+ * @return {uint32_t} frames
+ */
+uint32_t SerialMirror::getSkipped() const {
+    return num_skipped;
+}
+
+/**
+ * Get number of bytes sent
+ *
+ * @return {uint32_t} bytes
+ */
+uint32_t SerialMirror::getBytes() const {
+    return num_bytes;
+}
+
+
+#endif /* SerialMirror_h */
@@ -0,0 +1,201 @@
+#ifndef Sram_h
+#define Sram_h
+
+/*******************************************************************************
+ *                                  Includes                                   *
+ *******************************************************************************/
+
+#include <Arduino.h>
+
+
+/*******************************************************************************
+ *                                SRAM Settings                                *
+ *******************************************************************************/
+
+/**
+ * SRAM of the target board, 0 to not check. Taken from the AVR's memory map
+ * when there is one, e.g. 2048 on an Uno and 8192 on a Mega.
+ */
+#ifndef GAME_SRAM_BYTES
+    #if defined(RAMEND) && defined(RAMSTART)
+        #define GAME_SRAM_BYTES ((uint32_t)RAMEND - RAMSTART + 1)
+    #else
+        #define GAME_SRAM_BYTES 0
+    #endif /* RAMEND && RAMSTART */
+#endif /* GAME_SRAM_BYTES */
+
+/**
+ * SRAM kept free of the game for the stack, Serial's buffers and the core's
+ * globals
+ */
+#ifndef GAME_SRAM_RESERVE
+    #define GAME_SRAM_RESERVE 384
+#endif /* GAME_SRAM_RESERVE */
+
+/**
+ * Bytes `malloc` keeps in front of every block, 2 in avr-libc
+ */
+#ifndef GAME_SRAM_HEAP_OVERHEAD
+    #define GAME_SRAM_HEAP_OVERHEAD 2
+#endif /* GAME_SRAM_HEAP_OVERHEAD */
+
+
+/*******************************************************************************
+ *                                 SRAM Usage                                  *
+ *******************************************************************************/
+
+/**
+ * SRAM a game takes once constructed, by part, as worked out at compile time
+ * by the games' `sram` from the same settings their constructors use. Sizes
+ * are those of whatever it is compiled for, so the check only means something
+ * in the build for the board. Everything but the game object and the profile
+ * is on the heap, in `num_blocks` blocks.
+ */
+struct SramUsage {
+    /**
+     * Board it was worked out for
+     */
+    uint8_t width;
+    uint8_t height;
+
+    /**
+     * The game object itself, a global in the sketch, palettes included
+     */
+    uint32_t object;
+
+    /**
+     * NeoMatrix object and its strip buffer
+     */
+    uint32_t matrix;
+
+    /**
+     * Board the game plays on
+     */
+    uint32_t board;
+
+    /**
+     * What the game adds, e.g. Conway's checking boards or the ants
+     */
+    uint32_t game;
+
+    /**
+     * Draw order with GAME_DRAW_ORDER_TABLE and the strip index with
+     * GAME_PIXEL_INDEX_MAP, 2 bytes per LED each
+     */
+    uint32_t tables;
+
+    /**
+     * Board copy and pending spans of GAME_SERIAL_MIRROR
+     */
+    uint32_t mirror;
+
+    /**
+     * Histograms of GAME_PROFILE, a global
+     */
+    uint32_t profile;
+
+    uint16_t num_blocks;
+
+    constexpr SramUsage withGame(uint32_t _object, uint32_t _game, uint16_t _num_blocks) const;
+
+    constexpr uint32_t heap() const;
+    constexpr uint32_t total() const;
+    constexpr bool fits() const;
+
+    void print(Print * out) const;
+};
+
+
+/**
+ * Same usage as a subclass that is `_object` big and adds `_game` bytes in
+ * `_num_blocks` blocks
+ *
+ * @param  {uint32_t} _object      sizeof the subclass
+ * @param  {uint32_t} _game        bytes it allocates
+ * @param  {uint16_t} _num_blocks  blocks it allocates
+ * @return {SramUsage}
+ */
+constexpr SramUsage SramUsage::withGame(uint32_t _object, uint32_t _game, uint16_t _num_blocks) const {
+    return SramUsage {
+        width,
+        height,
+        _object,
+        matrix,
+        board,
+        game + _game,
+        tables,
+        mirror,
+        profile,
+        (uint16_t)(num_blocks + _num_blocks)
+    };
+}
+
+/**
+ * Bytes on the heap, `malloc`'s own included
+ *
+ * @return {uint32_t} bytes
+ */
+constexpr uint32_t SramUsage::heap() const {
+    return matrix + board + game + tables + mirror + (uint32_t)num_blocks * GAME_SRAM_HEAP_OVERHEAD;
+}
+
+/**
+ * Bytes in all
+ *
+ * @return {uint32_t} bytes
+ */
+constexpr uint32_t SramUsage::total() const {
+    return object + profile + heap();
+}
+
+/**
+ * Truth of fitting in GAME_SRAM_BYTES with GAME_SRAM_RESERVE to spare, or of
+ * there being no target
+ *
+ * @return {bool}
+ */
+constexpr bool SramUsage::fits() const {
+    return GAME_SRAM_BYTES == 0 || total() + GAME_SRAM_RESERVE <= GAME_SRAM_BYTES;
+}
+
+/**
+ * Print the breakdown, a part per line
+ *
+ * @param  {Print *} out  e.g. &Serial
+ */
+void SramUsage::print(Print * out) const {
+    static const char * names[] = {
+        "object", "matrix", "board", "game", "tables", "mirror", "profile"
+    };
+    const uint32_t bytes[] = {
+        object, matrix, board, game, tables, mirror, profile
+    };
+
+    out->print("size ");
+    out->print(width);
+    out->print('x');
+    out->println(height);
+
+    for (uint8_t i_part = 0; i_part < sizeof(bytes) / sizeof(bytes[0]); i_part++) {
+        out->print(names[i_part]);
+        out->print(' ');
+        out->println(bytes[i_part]);
+    }
+
+    out->print("malloc ");
+    out->println((uint32_t)num_blocks * GAME_SRAM_HEAP_OVERHEAD);
+
+    out->print("total ");
+    out->print(total());
+
+    if (GAME_SRAM_BYTES) {
+        out->print(" + ");
+        out->print((uint32_t)GAME_SRAM_RESERVE);
+        out->print(" reserved of ");
+        out->print((uint32_t)GAME_SRAM_BYTES);
+    }
+
+    out->println();
+}
+
+#endif /* Sram_h */
@@ -0,0 +1,77 @@
+#ifndef Adafruit_GFX_h
+#define Adafruit_GFX_h
+
+/*******************************************************************************
+ *                                  Includes                                   *
+ *******************************************************************************/
+
+#include <stdint.h>
+
+
+/*******************************************************************************
+ *                                    GFX                                      *
+ *******************************************************************************/
+
+/**
+ * Stand in for the part of Adafruit_GFX the games draw through, a width and
+ * height and per pixel drawing
+ */
+class Adafruit_GFX {
+protected:
+    int16_t _width;
+    int16_t _height;
+
+public:
+    Adafruit_GFX(int16_t w, int16_t h);
+    virtual ~Adafruit_GFX() { }
+
+    virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+    virtual void fillScreen(uint16_t color);
+
+    int16_t width() const;
+    int16_t height() const;
+};
+
+
+/**
+ * Init GFX
+ *
+ * @param {int16_t} w  width
+ * @param {int16_t} h  height
+ */
+Adafruit_GFX::Adafruit_GFX(int16_t w, int16_t h) {
+    _width = w;
+    _height = h;
+}
+
+/**
+ * Draw every pixel in `color`
+ *
+ * @param  {uint16_t} color  565 color
+ */
+void Adafruit_GFX::fillScreen(uint16_t color) {
+    for (int16_t y = 0; y < _height; y++) {
+        for (int16_t x = 0; x < _width; x++) drawPixel(x, y, color);
+    }
+}
+
+/**
+ * Get width
+ *
+ * @return {int16_t} width
+ */
+int16_t Adafruit_GFX::width() const {
+    return _width;
+}
+
+/**
+ * Get height
+ *
+ * @return {int16_t} height
+ */
+int16_t Adafruit_GFX::height() const {
+    return _height;
+}
+
+
+#endif /* Adafruit_GFX_h */
@@ -0,0 +1,296 @@
+#ifndef Adafruit_NeoMatrix_h
+#define Adafruit_NeoMatrix_h
+
+/*******************************************************************************
+ *                                  Includes                                   *
+ *******************************************************************************/
+
+#include "Adafruit_GFX.h"
+#include "Adafruit_NeoPixel.h"
+
+
+/*******************************************************************************
+ *                              Matrix Layouts                                 *
+ *******************************************************************************/
+
+/**
+ * Same bits as the library: corner, axis and sequence of the LEDs within each
+ * matrix in the low nibble, of the matrices within the tiling in the high
+ */
+#define NEO_MATRIX_TOP         0x00
+#define NEO_MATRIX_BOTTOM      0x01
+#define NEO_MATRIX_LEFT        0x00
+#define NEO_MATRIX_RIGHT       0x02
+#define NEO_MATRIX_CORNER      0x03
+#define NEO_MATRIX_ROWS        0x00
+#define NEO_MATRIX_COLUMNS     0x04
+#define NEO_MATRIX_AXIS        0x04
+#define NEO_MATRIX_PROGRESSIVE 0x00
+#define NEO_MATRIX_ZIGZAG      0x08
+#define NEO_MATRIX_SEQUENCE    0x08
+
+#define NEO_TILE_TOP           0x00
+#define NEO_TILE_BOTTOM        0x10
+#define NEO_TILE_LEFT          0x00
+#define NEO_TILE_RIGHT         0x20
+#define NEO_TILE_CORNER        0x30
+#define NEO_TILE_ROWS          0x00
+#define NEO_TILE_COLUMNS       0x40
+#define NEO_TILE_AXIS          0x40
+#define NEO_TILE_PROGRESSIVE   0x00
+#define NEO_TILE_ZIGZAG        0x80
+#define NEO_TILE_SEQUENCE      0x80
+
+
+/*******************************************************************************
+ *                                NeoMatrix                                    *
+ *******************************************************************************/
+
+/**
+ * In memory stand in for Adafruit_NeoMatrix, with the library's tile, corner
+ * and zigzag layout math
+ */
+class Adafruit_NeoMatrix : public Adafruit_GFX, public Adafruit_NeoPixel {
+private:
+    uint8_t type;
+    uint8_t matrix_width;
+    uint8_t matrix_height;
+    uint8_t tiles_x;
+    uint8_t tiles_y;
+
+    bool pass_thru;
+    uint32_t pass_thru_color;
+
+    static uint32_t _expandColor(uint16_t color);
+
+public:
+    Adafruit_NeoMatrix(
+        int w,
+        int h,
+        uint8_t pin = 6,
+        uint8_t matrix_type = NEO_MATRIX_TOP + NEO_MATRIX_LEFT + NEO_MATRIX_ROWS,
+        neoPixelType led_type = NEO_GRB + NEO_KHZ800
+    );
+    Adafruit_NeoMatrix(
+        uint8_t matrix_w,
+        uint8_t matrix_h,
+        uint8_t tX,
+        uint8_t tY,
+        uint8_t pin = 6,
+        uint8_t matrix_type = NEO_MATRIX_TOP + NEO_MATRIX_LEFT + NEO_MATRIX_ROWS + NEO_TILE_TOP + NEO_TILE_LEFT + NEO_TILE_ROWS,
+        neoPixelType led_type = NEO_GRB + NEO_KHZ800
+    );
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color);
+    void fillScreen(uint16_t color);
+
+    void setPassThruColor(uint32_t c);
+    void setPassThruColor();
+
+    int32_t getPixelIndex(int16_t x, int16_t y) const;
+
+    static uint16_t Color(uint8_t r, uint8_t g, uint8_t b);
+};
+
+
+/**
+ * Init single matrix
+ *
+ * @param {int}          w            width
+ * @param {int}          h            height
+ * @param {uint8_t}      pin          unused
+ * @param {uint8_t}      matrix_type  NEO_MATRIX_* layout
+ * @param {neoPixelType} led_type     NEO_* color order and speed
+ */
+Adafruit_NeoMatrix::Adafruit_NeoMatrix(
+    int w,
+    int h,
+    uint8_t pin,
+    uint8_t matrix_type,
+    neoPixelType led_type
+):
+    Adafruit_GFX(w, h),
+    Adafruit_NeoPixel(w * h, pin, led_type)
+{
+    type = matrix_type;
+    matrix_width = w;
+    matrix_height = h;
+    tiles_x = 0;
+    tiles_y = 0;
+
+    pass_thru = false;
+    pass_thru_color = 0;
+}
+
+/**
+ * Init tiled matrices
+ *
+ * @param {uint8_t}      matrix_w     width of each matrix
+ * @param {uint8_t}      matrix_h     height of each matrix
+ * @param {uint8_t}      tX           matrices across
+ * @param {uint8_t}      tY           matrices down
+ * @param {uint8_t}      pin          unused
+ * @param {uint8_t}      matrix_type  NEO_MATRIX_* and NEO_TILE_* layout
+ * @param {neoPixelType} led_type     NEO_* color order and speed
+ */
+Adafruit_NeoMatrix::Adafruit_NeoMatrix(
+    uint8_t matrix_w,
+    uint8_t matrix_h,
+    uint8_t tX,
+    uint8_t tY,
+    uint8_t pin,
+    uint8_t matrix_type,
+    neoPixelType led_type
+):
+    Adafruit_GFX(matrix_w * tX, matrix_h * tY),
+    Adafruit_NeoPixel(matrix_w * matrix_h * tX * tY, pin, led_type)
+{
+    type = matrix_type;
+    matrix_width = matrix_w;
+    matrix_height = matrix_h;
+    tiles_x = tX;
+    tiles_y = tY;
+
+    pass_thru = false;
+    pass_thru_color = 0;
+}
+
+/**
+ * Expand a 565 color to 24 bits, gamma corrected as the library does
+ *
+ * @param  {uint16_t} color  565 color
+ * @return {uint32_t}        0x00RRGGBB
+ */
+uint32_t Adafruit_NeoMatrix::_expandColor(uint16_t color) {
+    return Adafruit_NeoPixel::Color(
+        gamma8((color >> 11) * 255 / 31),
+        gamma8(((color >> 5) & 0x3F) * 255 / 63),
+        gamma8((color & 0x1F) * 255 / 31)
+    );
+}
+
+/**
+ * Get strip index of pixel `x`, `y`
+ *
+ * @param  {int16_t} x
+ * @param  {int16_t} y
+ * @return {int32_t}    index, -1 if off the matrix
+ */
+int32_t Adafruit_NeoMatrix::getPixelIndex(int16_t x, int16_t y) const {
+    uint8_t corner = type & NEO_MATRIX_CORNER;
+    uint16_t minor;
+    uint16_t major;
+    uint16_t major_scale;
+    uint16_t swap;
+    uint16_t tile;
+    int32_t tile_offset = 0;
+
+    if (x < 0 || y < 0 || x >= _width || y >= _height) return -1;
+
+    if (tiles_x) {
+        minor = x / matrix_width;
+        major = y / matrix_height;
+        x -= minor * matrix_width;
+        y -= major * matrix_height;
+
+        if (type & NEO_TILE_RIGHT)  minor = tiles_x - 1 - minor;
+        if (type & NEO_TILE_BOTTOM) major = tiles_y - 1 - major;
+
+        if ((type & NEO_TILE_AXIS) == NEO_TILE_ROWS) major_scale = tiles_x;
+        else {
+            swap = major;
+            major = minor;
+            minor = swap;
+            major_scale = tiles_y;
+        }
+
+        /**
+         * Zigzag tiles flip the corner the matrix starts from
+         */
+        if ((type & NEO_TILE_SEQUENCE) == NEO_TILE_ZIGZAG && (major & 1)) {
+            corner ^= NEO_MATRIX_CORNER;
+            tile = (major + 1) * major_scale - 1 - minor;
+        }
+        else tile = major * major_scale + minor;
+
+        tile_offset = (int32_t)tile * matrix_width * matrix_height;
+    }
+
+    minor = x;
+    major = y;
+
+    if (corner & NEO_MATRIX_RIGHT)  minor = matrix_width - 1 - minor;
+    if (corner & NEO_MATRIX_BOTTOM) major = matrix_height - 1 - major;
+
+    if ((type & NEO_MATRIX_AXIS) == NEO_MATRIX_ROWS) major_scale = matrix_width;
+    else {
+        swap = major;
+        major = minor;
+        minor = swap;
+        major_scale = matrix_height;
+    }
+
+    if ((type & NEO_MATRIX_SEQUENCE) == NEO_MATRIX_ZIGZAG && (major & 1)) {
+        return tile_offset + (major + 1) * major_scale - 1 - minor;
+    }
+
+    return tile_offset + major * major_scale + minor;
+}
+
+/**
+ * Draw pixel `x`, `y` in `color`, or in the pass through color if set
+ *
+ * @param  {int16_t}  x
+ * @param  {int16_t}  y
+ * @param  {uint16_t} color  565 color
+ */
+void Adafruit_NeoMatrix::drawPixel(int16_t x, int16_t y, uint16_t color) {
+    int32_t i_pixel = getPixelIndex(x, y);
+
+    if (i_pixel < 0) return;
+
+    setPixelColor(i_pixel, pass_thru ? pass_thru_color : _expandColor(color));
+}
+
+/**
+ * Draw every pixel in `color`, or in the pass through color if set
+ *
+ * @param  {uint16_t} color  565 color
+ */
+void Adafruit_NeoMatrix::fillScreen(uint16_t color) {
+    uint32_t color_24 = pass_thru ? pass_thru_color : _expandColor(color);
+
+    for (uint16_t i_pixel = 0; i_pixel < numPixels(); i_pixel++) setPixelColor(i_pixel, color_24);
+}
+
+/**
+ * Draw in a 24-bit color as is, ignoring the 565 colors passed, until reset
+ *
+ * @param  {uint32_t} c  0xWWRRGGBB
+ */
+void Adafruit_NeoMatrix::setPassThruColor(uint32_t c) {
+    pass_thru = true;
+    pass_thru_color = c;
+}
+
+/**
+ * Go back to drawing in the 565 colors passed
+ */
+void Adafruit_NeoMatrix::setPassThruColor() {
+    pass_thru = false;
+}
+
+/**
+ * Pack a color as 565
+ *
+ * @param  {uint8_t} r  red
+ * @param  {uint8_t} g  green
+ * @param  {uint8_t} b  blue
+ * @return {uint16_t}   565 color
+ */
+uint16_t Adafruit_NeoMatrix::Color(uint8_t r, uint8_t g, uint8_t b) {
+    return ((uint16_t)(r & 0xF8) << 8) | ((uint16_t)(g & 0xFC) << 3) | (b >> 3);
+}
+
+
+#endif /* Adafruit_NeoMatrix_h */
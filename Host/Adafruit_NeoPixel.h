@@ -0,0 +1,401 @@
+#ifndef Adafruit_NeoPixel_h
+#define Adafruit_NeoPixel_h
+
+/*******************************************************************************
+ *                                  Includes                                   *
+ *******************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/*******************************************************************************
+ *                              NeoPixel Types                                 *
+ *******************************************************************************/
+
+/**
+ * Same encoding as the library: byte offsets of white, red, green and blue in
+ * bits 6-7, 4-5, 2-3 and 0-1, white equal to red meaning no white
+ */
+#define NEO_RGB  ((0 << 6) | (0 << 4) | (1 << 2) | (2))
+#define NEO_RBG  ((0 << 6) | (0 << 4) | (2 << 2) | (1))
+#define NEO_GRB  ((1 << 6) | (1 << 4) | (0 << 2) | (2))
+#define NEO_GBR  ((2 << 6) | (2 << 4) | (0 << 2) | (1))
+#define NEO_BRG  ((1 << 6) | (1 << 4) | (2 << 2) | (0))
+#define NEO_BGR  ((2 << 6) | (2 << 4) | (1 << 2) | (0))
+
+#define NEO_RGBW ((3 << 6) | (0 << 4) | (1 << 2) | (2))
+#define NEO_GRBW ((3 << 6) | (1 << 4) | (0 << 2) | (2))
+
+#define NEO_KHZ800 0x0000
+#define NEO_KHZ400 0x0100
+
+typedef uint16_t neoPixelType;
+
+
+/*******************************************************************************
+ *                                 NeoPixel                                    *
+ *******************************************************************************/
+
+class Adafruit_NeoPixel;
+
+/**
+ * Called by `show` with the strip, in place of sending it out on the pin
+ */
+typedef void (*NeoPixelShowHandler)(Adafruit_NeoPixel * strip, void * context);
+
+/**
+ * In memory stand in for Adafruit_NeoPixel. Keeps the strip buffer exactly as
+ * the library does, color order and brightness applied, and hands it to a
+ * show handler instead of a pin.
+ */
+class Adafruit_NeoPixel {
+private:
+    uint16_t num_leds;
+    uint16_t num_bytes;
+    uint8_t * pixels;
+
+    /**
+     * Brightness + 1 as the library keeps it, so 255 wraps to 0 for unscaled
+     */
+    uint8_t brightness;
+
+    uint8_t r_offset;
+    uint8_t g_offset;
+    uint8_t b_offset;
+    uint8_t w_offset;
+
+    uint32_t num_shows;
+
+    NeoPixelShowHandler show_handler;
+    void * show_context;
+
+public:
+    Adafruit_NeoPixel(uint16_t n, uint8_t pin = 6, neoPixelType type = NEO_GRB + NEO_KHZ800);
+    ~Adafruit_NeoPixel();
+
+    void begin();
+    void show();
+
+    void setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b);
+    void setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b, uint8_t w);
+    void setPixelColor(uint16_t n, uint32_t c);
+    void setBrightness(uint8_t b);
+    void clear();
+
+    uint8_t * getPixels() const;
+    uint8_t getBrightness() const;
+    uint16_t numPixels() const;
+    uint32_t getPixelColor(uint16_t n) const;
+
+    static uint32_t Color(uint8_t r, uint8_t g, uint8_t b);
+    static uint32_t Color(uint8_t r, uint8_t g, uint8_t b, uint8_t w);
+    static uint8_t gamma8(uint8_t x);
+
+    void setShowHandler(NeoPixelShowHandler handler, void * context);
+    uint32_t getShowCount() const;
+    uint8_t getBytesPerPixel() const;
+    uint8_t getOffset(uint8_t i_channel) const;
+};
+
+
+/**
+ * Init NeoPixel strip. The library counts strip bytes in 16 bits, so a strip
+ * over 0xFFFF bytes is refused here rather than given a short buffer.
+ *
+ * @param {uint16_t}     n     number of LEDs
+ * @param {uint8_t}      pin   unused
+ * @param {neoPixelType} type  NEO_* color order and speed
+ */
+Adafruit_NeoPixel::Adafruit_NeoPixel(uint16_t n, uint8_t pin, neoPixelType type) {
+    uint32_t bytes;
+
+    (void)pin;
+
+    r_offset = (type >> 4) & 3;
+    g_offset = (type >> 2) & 3;
+    b_offset = type & 3;
+    w_offset = (type >> 6) & 3;
+
+    bytes = (uint32_t)n * (w_offset == r_offset ? 3 : 4);
+
+    if (bytes > 0xFFFF) {
+        fprintf(stderr, "Adafruit_NeoPixel: %u LEDs need %lu bytes, at most 65535 fit\n", n, (unsigned long)bytes);
+        abort();
+    }
+
+    num_leds = n;
+    num_bytes = bytes;
+    pixels = (uint8_t *)calloc(num_bytes ? num_bytes : 1, 1);
+
+    brightness = 0;
+    num_shows = 0;
+
+    show_handler = NULL;
+    show_context = NULL;
+}
+
+/**
+ * Free strip buffer
+ */
+Adafruit_NeoPixel::~Adafruit_NeoPixel() {
+    free(pixels);
+}
+
+/**
+ * Nothing to set up without a pin
+ */
+void Adafruit_NeoPixel::begin() { }
+
+/**
+ * Hand the strip buffer to the show handler, if any
+ */
+void Adafruit_NeoPixel::show() {
+    num_shows++;
+
+    if (show_handler) show_handler(this, show_context);
+}
+
+/**
+ * Set LED `n`, scaled by brightness
+ *
+ * @param  {uint16_t} n  LED
+ * @param  {uint8_t}  r  red
+ * @param  {uint8_t}  g  green
+ * @param  {uint8_t}  b  blue
+ */
+void Adafruit_NeoPixel::setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b) {
+    setPixelColor(n, r, g, b, 0);
+}
+
+/**
+ * Set LED `n`, scaled by brightness. White is dropped on RGB strips.
+ *
+ * @param  {uint16_t} n  LED
+ * @param  {uint8_t}  r  red
+ * @param  {uint8_t}  g  green
+ * @param  {uint8_t}  b  blue
+ * @param  {uint8_t}  w  white
+ */
+void Adafruit_NeoPixel::setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b, uint8_t w) {
+    uint8_t * pixel;
+
+    if (n >= num_leds) return;
+
+    if (brightness) {
+        r = (r * brightness) >> 8;
+        g = (g * brightness) >> 8;
+        b = (b * brightness) >> 8;
+        w = (w * brightness) >> 8;
+    }
+
+    pixel = pixels + (uint32_t)n * getBytesPerPixel();
+
+    if (w_offset != r_offset) pixel[w_offset] = w;
+
+    pixel[r_offset] = r;
+    pixel[g_offset] = g;
+    pixel[b_offset] = b;
+}
+
+/**
+ * Set LED `n` from a packed 0xWWRRGGBB color, scaled by brightness
+ *
+ * @param  {uint16_t} n  LED
+ * @param  {uint32_t} c  color
+ */
+void Adafruit_NeoPixel::setPixelColor(uint16_t n, uint32_t c) {
+    setPixelColor(n, (uint8_t)(c >> 16), (uint8_t)(c >> 8), (uint8_t)c, (uint8_t)(c >> 24));
+}
+
+/**
+ * Set brightness, rescaling what is already in the strip buffer the same
+ * lossy way the library does
+ *
+ * @param  {uint8_t} b  0 to 255
+ */
+void Adafruit_NeoPixel::setBrightness(uint8_t b) {
+    uint8_t brightness_new = b + 1;
+    uint8_t brightness_old = brightness - 1;
+    uint16_t scale;
+    uint16_t i_byte;
+    uint8_t value;
+
+    if (brightness_new == brightness) return;
+
+    if (brightness_old == 0) scale = 0;
+    else if (b == 255) scale = 65535 / brightness_old;
+    else scale = (((uint16_t)brightness_new << 8) - 1) / brightness_old;
+
+    for (i_byte = 0; i_byte < num_bytes; i_byte++) {
+        value = pixels[i_byte];
+        pixels[i_byte] = (value * scale) >> 8;
+    }
+
+    brightness = brightness_new;
+}
+
+/**
+ * Set every LED off
+ */
+void Adafruit_NeoPixel::clear() {
+    memset(pixels, 0, num_bytes);
+}
+
+/**
+ * Get strip buffer, in the strip's color order with brightness applied
+ *
+ * @return {uint8_t *} pixels
+ */
+uint8_t * Adafruit_NeoPixel::getPixels() const {
+    return pixels;
+}
+
+/**
+ * Get brightness as set
+ *
+ * @return {uint8_t} brightness
+ */
+uint8_t Adafruit_NeoPixel::getBrightness() const {
+    return brightness - 1;
+}
+
+/**
+ * Get number of LEDs
+ *
+ * @return {uint16_t} number of LEDs
+ */
+uint16_t Adafruit_NeoPixel::numPixels() const {
+    return num_leds;
+}
+
+/**
+ * Get LED `n` as a packed 0xWWRRGGBB color, brightness undone as far as it
+ * can be
+ *
+ * @param  {uint16_t} n  LED
+ * @return {uint32_t}    color
+ */
+uint32_t Adafruit_NeoPixel::getPixelColor(uint16_t n) const {
+    const uint8_t * pixel;
+    uint32_t channels[4];
+
+    if (n >= num_leds) return 0;
+
+    pixel = pixels + (uint32_t)n * getBytesPerPixel();
+
+    channels[0] = w_offset != r_offset ? pixel[w_offset] : 0;
+    channels[1] = pixel[r_offset];
+    channels[2] = pixel[g_offset];
+    channels[3] = pixel[b_offset];
+
+    if (brightness) {
+        for (uint8_t i_channel = 0; i_channel < 4; i_channel++) {
+            channels[i_channel] = (channels[i_channel] << 8) / brightness;
+        }
+    }
+
+    return (channels[0] << 24) | (channels[1] << 16) | (channels[2] << 8) | channels[3];
+}
+
+/**
+ * Pack a color
+ *
+ * @param  {uint8_t} r  red
+ * @param  {uint8_t} g  green
+ * @param  {uint8_t} b  blue
+ * @return {uint32_t}   0x00RRGGBB
+ */
+uint32_t Adafruit_NeoPixel::Color(uint8_t r, uint8_t g, uint8_t b) {
+    return ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+}
+
+/**
+ * Pack a color with white
+ *
+ * @param  {uint8_t} r  red
+ * @param  {uint8_t} g  green
+ * @param  {uint8_t} b  blue
+ * @param  {uint8_t} w  white
+ * @return {uint32_t}   0xWWRRGGBB
+ */
+uint32_t Adafruit_NeoPixel::Color(uint8_t r, uint8_t g, uint8_t b, uint8_t w) {
+    return ((uint32_t)w << 24) | ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+}
+
+/**
+ * Gamma correct a channel, same 2.6 gamma table as the library
+ *
+ * @param  {uint8_t} x  linear
+ * @return {uint8_t}    corrected
+ */
+uint8_t Adafruit_NeoPixel::gamma8(uint8_t x) {
+    static const uint8_t gamma_table[256] = {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   1,   1,   1,   1,   1,   1,   1,   1,
+          1,   1,   1,   1,   2,   2,   2,   2,   2,   2,   2,   2,   3,   3,   3,   3,
+          3,   3,   4,   4,   4,   4,   5,   5,   5,   5,   5,   6,   6,   6,   6,   7,
+          7,   7,   8,   8,   8,   9,   9,   9,  10,  10,  10,  11,  11,  11,  12,  12,
+         13,  13,  13,  14,  14,  15,  15,  16,  16,  17,  17,  18,  18,  19,  19,  20,
+         20,  21,  21,  22,  22,  23,  24,  24,  25,  25,  26,  27,  27,  28,  29,  29,
+         30,  31,  31,  32,  33,  34,  34,  35,  36,  37,  38,  38,  39,  40,  41,  42,
+         42,  43,  44,  45,  46,  47,  48,  49,  50,  51,  52,  53,  54,  55,  56,  57,
+         58,  59,  60,  61,  62,  63,  64,  65,  66,  68,  69,  70,  71,  72,  73,  75,
+         76,  77,  78,  80,  81,  82,  84,  85,  86,  88,  89,  90,  92,  93,  94,  96,
+         97,  99, 100, 102, 103, 105, 106, 108, 109, 111, 112, 114, 115, 117, 119, 120,
+        122, 124, 125, 127, 129, 130, 132, 134, 136, 137, 139, 141, 143, 145, 146, 148,
+        150, 152, 154, 156, 158, 160, 162, 164, 166, 168, 170, 172, 174, 176, 178, 180,
+        182, 184, 186, 188, 191, 193, 195, 197, 199, 202, 204, 206, 209, 211, 213, 215,
+        218, 220, 223, 225, 227, 230, 232, 235, 237, 240, 242, 245, 247, 250, 252, 255
+    };
+
+    return gamma_table[x];
+}
+
+/**
+ * Call `handler` on every `show`, NULL for none
+ *
+ * @param  {NeoPixelShowHandler} handler
+ * @param  {void *}              context  passed to `handler`
+ */
+void Adafruit_NeoPixel::setShowHandler(NeoPixelShowHandler handler, void * context) {
+    show_handler = handler;
+    show_context = context;
+}
+
+/**
+ * Get number of times `show` was called
+ *
+ * @return {uint32_t} shows
+ */
+uint32_t Adafruit_NeoPixel::getShowCount() const {
+    return num_shows;
+}
+
+/**
+ * Get bytes per LED in the strip buffer
+ *
+ * @return {uint8_t} 3 or 4
+ */
+uint8_t Adafruit_NeoPixel::getBytesPerPixel() const {
+    return w_offset == r_offset ? 3 : 4;
+}
+
+/**
+ * Get byte offset of a channel within an LED
+ *
+ * @param  {uint8_t} i_channel  0 red, 1 green, 2 blue, 3 white
+ * @return {uint8_t}            offset
+ */
+uint8_t Adafruit_NeoPixel::getOffset(uint8_t i_channel) const {
+    if (i_channel == 0) return r_offset;
+    if (i_channel == 1) return g_offset;
+    if (i_channel == 2) return b_offset;
+
+    return w_offset;
+}
+
+
+#endif /* Adafruit_NeoPixel_h */
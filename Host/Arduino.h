@@ -0,0 +1,365 @@
+#ifndef Arduino_h
+#define Arduino_h
+
+/*******************************************************************************
+ *                                  Includes                                   *
+ *******************************************************************************/
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <string>
+#include <type_traits>
+
+
+/*******************************************************************************
+ *                                 Arduino Host                                *
+ *******************************************************************************/
+
+/**
+ * Stand in for the part of the Arduino core the games use, so they build and
+ * run on a desktop unchanged. Behaves like an AVR board where it matters for
+ * reproducing a run: `random` is avr-libc's generator, `analogRead` returns
+ * the same noise every run and time only moves on through `delay`, so a run
+ * gives the same boards every time however fast the host is.
+ */
+
+typedef bool boolean;
+typedef uint8_t byte;
+typedef uint16_t word;
+
+#define HIGH 0x1
+#define LOW  0x0
+
+#define INPUT        0x0
+#define OUTPUT       0x1
+#define INPUT_PULLUP 0x2
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+#define A0 14
+#define A1 15
+#define A2 16
+#define A3 17
+#define A4 18
+#define A5 19
+
+#define PROGMEM
+#define PSTR(s) (s)
+#define F(s) (s)
+
+#define pgm_read_byte(address) (*(const uint8_t *)(address))
+#define pgm_read_word(address) (*(const uint16_t *)(address))
+#define pgm_read_dword(address) (*(const uint32_t *)(address))
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+#define bitSet(value, bit) ((value) |= (1UL << (bit)))
+#define bitClear(value, bit) ((value) &= ~(1UL << (bit)))
+
+/**
+ * Size of the Serial transmit buffer, as on AVR
+ */
+#define SERIAL_TX_BUFFER_SIZE 64
+
+/**
+ * Functions rather than the core's macros, so they don't clash with the
+ * standard library. The result has the common type, as the macros give.
+ */
+template <class A, class B>
+inline typename std::common_type<A, B>::type min(A a, B b) {
+    return a < b ? a : b;
+}
+
+template <class A, class B>
+inline typename std::common_type<A, B>::type max(A a, B b) {
+    return a > b ? a : b;
+}
+
+inline long map(long x, long in_min, long in_max, long out_min, long out_max) {
+    return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+
+inline void pinMode(uint8_t pin, uint8_t mode) { (void)pin; (void)mode; }
+inline void digitalWrite(uint8_t pin, uint8_t value) { (void)pin; (void)value; }
+inline int digitalRead(uint8_t pin) { (void)pin; return LOW; }
+inline void yield() { }
+
+
+/*******************************************************************************
+ *                                Virtual Clock                                *
+ *******************************************************************************/
+
+/**
+ * Microseconds since start up. Only `delay` and `delayMicroseconds` move it
+ * on, so time spent computing doesn't count.
+ */
+static uint64_t arduino_host_clock_us = 0;
+
+inline void delay(unsigned long ms) {
+    arduino_host_clock_us += (uint64_t)ms * 1000;
+}
+
+inline void delayMicroseconds(unsigned int us) {
+    arduino_host_clock_us += us;
+}
+
+/**
+ * 32 bits like on AVR, so they wrap around the same
+ */
+inline unsigned long millis() {
+    return (uint32_t)(arduino_host_clock_us / 1000);
+}
+
+inline unsigned long micros() {
+    return (uint32_t)arduino_host_clock_us;
+}
+
+
+/*******************************************************************************
+ *                                   Random                                    *
+ *******************************************************************************/
+
+/**
+ * avr-libc's `random`, Park and Miller's minimal standard generator, so a
+ * seed gives the same numbers as on the board
+ */
+static uint32_t arduino_host_random_next = 1;
+
+inline long arduino_host_random() {
+    long hi;
+    long lo;
+    long x = arduino_host_random_next;
+
+    /**
+     * Can't be initialized with 0
+     */
+    if (x == 0) x = 123459876L;
+
+    hi = x / 127773L;
+    lo = x % 127773L;
+    x = 16807L * lo - 2836L * hi;
+    if (x < 0) x += 0x7FFFFFFFL;
+
+    arduino_host_random_next = x;
+
+    return x % ((uint32_t)0x7FFFFFFFL + 1);
+}
+
+/**
+ * Overloads next to the C library's `random()`, like the core's WMath
+ */
+inline long random(long howbig) {
+    if (howbig == 0) return 0;
+
+    return arduino_host_random() % howbig;
+}
+
+inline long random(long howsmall, long howbig) {
+    if (howsmall >= howbig) return howsmall;
+
+    return random(howbig - howsmall) + howsmall;
+}
+
+inline void randomSeed(unsigned long seed) {
+    if (seed != 0) arduino_host_random_next = seed;
+}
+
+
+/*******************************************************************************
+ *                                Analog Read                                  *
+ *******************************************************************************/
+
+/**
+ * Floating pin noise, the same sequence every run. Set the seed to get a
+ * different run.
+ */
+static uint32_t arduino_host_analog_seed = 12345;
+
+inline int analogRead(uint8_t pin) {
+    arduino_host_analog_seed = arduino_host_analog_seed * 1103515245UL + 12345UL + pin;
+
+    return (arduino_host_analog_seed >> 16) & 1023;
+}
+
+inline void analogReadSeed(uint32_t seed) {
+    arduino_host_analog_seed = seed;
+}
+
+
+/*******************************************************************************
+ *                                   String                                    *
+ *******************************************************************************/
+
+/**
+ * Formats numbers like the core's String, floats with 2 decimals
+ */
+class String {
+private:
+    std::string text;
+
+    static std::string _format(unsigned long value, uint8_t base) {
+        char digits[8 * sizeof(long) + 1];
+        char * digit = digits + sizeof(digits) - 1;
+
+        *digit = '\0';
+        if (base < 2) base = 10;
+
+        do {
+            *--digit = "0123456789abcdef"[value % base];
+            value /= base;
+        } while (value);
+
+        return digit;
+    }
+
+public:
+    String(const char * value = "") : text(value ? value : "") { }
+    String(const std::string & value) : text(value) { }
+    String(char value) : text(1, value) { }
+    String(unsigned char value, uint8_t base = DEC) : text(_format(value, base)) { }
+    String(int value, uint8_t base = DEC) : text(value < 0 && base == DEC ? "-" + _format(-(long)value, base) : _format((unsigned int)value, base)) { }
+    String(unsigned int value, uint8_t base = DEC) : text(_format(value, base)) { }
+    String(long value, uint8_t base = DEC) : text(value < 0 && base == DEC ? "-" + _format(-(unsigned long)value, base) : _format((unsigned long)value, base)) { }
+    String(unsigned long value, uint8_t base = DEC) : text(_format(value, base)) { }
+    String(double value, uint8_t decimal_places = 2) {
+        char formatted[64];
+
+        snprintf(formatted, sizeof(formatted), "%.*f", decimal_places, value);
+        text = formatted;
+    }
+
+    const char * c_str() const { return text.c_str(); }
+    unsigned int length() const { return text.length(); }
+
+    String & operator+=(const String & other) {
+        text += other.text;
+        return *this;
+    }
+
+    bool operator==(const String & other) const { return text == other.text; }
+    bool operator!=(const String & other) const { return text != other.text; }
+
+    friend String operator+(const String & a, const String & b) {
+        return String(a.text + b.text);
+    }
+};
+
+
+/*******************************************************************************
+ *                                    Print                                    *
+ *******************************************************************************/
+
+/**
+ * Base of anything bytes and text are written to, as in the core
+ */
+class Print {
+public:
+    virtual ~Print() { }
+
+    virtual size_t write(uint8_t value) = 0;
+
+    virtual size_t write(const uint8_t * buffer, size_t size) {
+        size_t written = 0;
+
+        while (size--) written += write(*buffer++);
+
+        return written;
+    }
+
+    size_t write(const char * text) {
+        return write((const uint8_t *)text, strlen(text));
+    }
+
+    /**
+     * Bytes that can be written without blocking
+     */
+    virtual int availableForWrite() { return 0; }
+
+    virtual void flush() { }
+
+    size_t print(const String & value) { return write(value.c_str()); }
+    size_t print(const char * value) { return write(value); }
+    size_t print(char value) { return write((uint8_t)value); }
+    size_t print(unsigned char value, int base = DEC) { return print(String(value, base)); }
+    size_t print(int value, int base = DEC) { return print(String(value, base)); }
+    size_t print(unsigned int value, int base = DEC) { return print(String(value, base)); }
+    size_t print(long value, int base = DEC) { return print(String(value, base)); }
+    size_t print(unsigned long value, int base = DEC) { return print(String(value, base)); }
+    size_t print(double value, int digits = 2) { return print(String(value, digits)); }
+
+    size_t println() { return write("\r\n"); }
+
+    template <class T>
+    size_t println(T value) {
+        size_t written = print(value);
+
+        return written + println();
+    }
+
+    template <class T>
+    size_t println(T value, int format) {
+        size_t written = print(value, format);
+
+        return written + println();
+    }
+};
+
+
+/*******************************************************************************
+ *                                   Serial                                    *
+ *******************************************************************************/
+
+/**
+ * Serial port writing to stdout, or any file, with nothing ever to read. Its
+ * transmit buffer drains straight away, so never blocks.
+ */
+class HardwareSerial : public Print {
+private:
+    FILE * file;
+
+public:
+    HardwareSerial() : file(stdout) { }
+
+    using Print::write;
+
+    void begin(unsigned long baud) { (void)baud; }
+    void end() { fflush(file); }
+
+    int available() { return 0; }
+    int read() { return -1; }
+    int peek() { return -1; }
+
+    size_t write(uint8_t value) {
+        return fputc(value, file) == EOF ? 0 : 1;
+    }
+
+    size_t write(const uint8_t * buffer, size_t size) {
+        return fwrite(buffer, 1, size, file);
+    }
+
+    int availableForWrite() { return SERIAL_TX_BUFFER_SIZE - 1; }
+
+    void flush() { fflush(file); }
+
+    operator bool() const { return true; }
+
+    /**
+     * Host only, write somewhere else than stdout
+     *
+     * @param  {FILE *} _file  open for writing
+     */
+    void setFile(FILE * _file) { file = _file; }
+};
+
+static HardwareSerial Serial;
+
+
+#endif /* Arduino_h */
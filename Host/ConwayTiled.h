@@ -0,0 +1,387 @@
+#ifndef ConwayTiled_h
+#define ConwayTiled_h
+
+/*******************************************************************************
+ *                                  Includes                                   *
+ *******************************************************************************/
+
+#include <Arduino.h>
+
+#include <errno.h>
+#include <pthread.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+
+/*******************************************************************************
+ *                               Local Includes                                *
+ *******************************************************************************/
+
+#include "../Games/Boards/Board.h"
+#include "../Games/ConwayPacked.h"
+
+
+/*******************************************************************************
+ *                           Conway Tiled Settings                             *
+ *******************************************************************************/
+
+/**
+ * Chance of a cell starting alive, out of 256
+ */
+#ifndef CONWAY_TILED_DENSITY
+    #define CONWAY_TILED_DENSITY 80
+#endif /* CONWAY_TILED_DENSITY */
+
+
+/*******************************************************************************
+ *                                    Soup                                     *
+ *******************************************************************************/
+
+/**
+ * Starting state of cell (x, y) of the whole board. Only depends on the seed
+ * and coordinates so every process seeds its own tile without talking.
+ *
+ * @param  {uint32_t} seed
+ * @param  {uint32_t} x     x coordiante on the whole board
+ * @param  {uint32_t} y     y coordiante on the whole board
+ * @return {bool}           truth of cell starting alive
+ */
+static inline bool conwayTiledSoup(uint32_t seed, uint32_t x, uint32_t y) {
+    uint64_t hash = ((uint64_t)seed << 32) ^ ((uint64_t)y << 16) ^ x;
+
+    hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebULL;
+    hash = hash ^ (hash >> 31);
+
+    return (hash & 0xFF) < CONWAY_TILED_DENSITY;
+}
+
+
+/*******************************************************************************
+ *                               Conway Tiled                                  *
+ *******************************************************************************/
+
+/**
+ * One Conway board split into `tiles_x` by `tiles_y` tiles, each stepped by
+ * its own process. Each process keeps its tile in a Board and steps it with
+ * ConwayPacked. Every generation the processes publish their edge rows and
+ * columns to shared memory, wait on a barrier, then read their neighbors'
+ * edges in as the one cell halo around their tile. Edges are double buffered
+ * by generation parity, so one barrier per generation is enough.
+ */
+class ConwayTiled {
+private:
+    uint16_t tiles_x;
+    uint16_t tiles_y;
+    uint8_t tile_width;
+    uint8_t tile_height;
+    bool wrap;
+
+    uint16_t row_words;
+    uint16_t column_words;
+    uint32_t edge_words;
+
+    /**
+     * Shared memory: barrier, then edges[2][tiles], then each tile's final
+     * rows
+     */
+    uint8_t * shared;
+    size_t shared_size;
+    pthread_barrier_t * barrier;
+    uint64_t * edges;
+    uint64_t * results;
+
+    uint64_t * _edges(uint8_t parity, int32_t tile_x, int32_t tile_y) const;
+    uint64_t * _result(uint16_t tile_x, uint16_t tile_y) const;
+
+    void _runTile(uint16_t tile_x, uint16_t tile_y, uint32_t seed, uint32_t generations);
+
+public:
+    ConwayTiled(uint16_t _tiles_x, uint16_t _tiles_y, uint8_t _tile_width, uint8_t _tile_height, bool _wrap = false);
+    ~ConwayTiled();
+
+    bool init();
+
+    uint32_t getWidth() const;
+    uint32_t getHeight() const;
+
+    bool run(uint32_t seed, uint32_t generations);
+
+    bool getAlive(uint32_t x, uint32_t y) const;
+};
+
+
+/**
+ * Init Conway Tiled. The shared memory is set up by `init`.
+ *
+ * @param {uint16_t} tiles_x      number of tiles in X direction
+ * @param {uint16_t} tiles_y      number of tiles in Y direction
+ * @param {uint8_t}  tile_width   multiple of CELLS_PER_BYTE
+ * @param {uint8_t}  tile_height
+ * @param {bool}     wrap         wrap the whole board around at its edges
+ */
+ConwayTiled::ConwayTiled(uint16_t _tiles_x, uint16_t _tiles_y, uint8_t _tile_width, uint8_t _tile_height, bool _wrap) {
+    tiles_x = _tiles_x;
+    tiles_y = _tiles_y;
+    tile_width = _tile_width;
+    tile_height = _tile_height;
+    wrap = _wrap;
+
+    row_words = (tile_width + 63) / 64;
+    column_words = (tile_height + 63) / 64;
+
+    /**
+     * Top row, bottom row, west column, east column
+     */
+    edge_words = 2 * row_words + 2 * column_words;
+
+    shared_size = sizeof(pthread_barrier_t) + 64
+        + 2 * (size_t)tiles_x * tiles_y * edge_words * sizeof(uint64_t)
+        + (size_t)tiles_x * tiles_y * tile_height * row_words * sizeof(uint64_t);
+
+    shared = NULL;
+    barrier = NULL;
+    edges = NULL;
+    results = NULL;
+}
+
+/**
+ * Release the shared memory
+ */
+ConwayTiled::~ConwayTiled() {
+    if (shared == NULL) return;
+
+    pthread_barrier_destroy(barrier);
+    munmap(shared, shared_size);
+}
+
+/**
+ * Map the shared memory every process uses and set up the barrier across
+ * the tiles. Prints why on failure.
+ *
+ * @return {bool} truth of the shared memory and barrier being ready
+ */
+bool ConwayTiled::init() {
+    pthread_barrierattr_t barrier_attr;
+    void * mapped;
+    int error;
+
+    mapped = mmap(NULL, shared_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (mapped == MAP_FAILED) {
+        fprintf(stderr, "can't map %zu bytes of shared memory: %s\n", shared_size, strerror(errno));
+        return false;
+    }
+
+    barrier = (pthread_barrier_t *)mapped;
+
+    pthread_barrierattr_init(&barrier_attr);
+    pthread_barrierattr_setpshared(&barrier_attr, PTHREAD_PROCESS_SHARED);
+    error = pthread_barrier_init(barrier, &barrier_attr, (unsigned)tiles_x * tiles_y);
+    pthread_barrierattr_destroy(&barrier_attr);
+
+    if (error) {
+        fprintf(stderr, "can't set up a barrier for %u tiles: %s\n", (unsigned)tiles_x * tiles_y, strerror(error));
+        munmap(mapped, shared_size);
+        return false;
+    }
+
+    shared = (uint8_t *)mapped;
+    edges = (uint64_t *)(shared + ((sizeof(pthread_barrier_t) + 63) / 64) * 64);
+    results = edges + 2 * (size_t)tiles_x * tiles_y * edge_words;
+
+    return true;
+}
+
+/**
+ * Get width of the whole board
+ *
+ * @return {uint32_t} width
+ */
+uint32_t ConwayTiled::getWidth() const {
+    return (uint32_t)tiles_x * tile_width;
+}
+
+/**
+ * Get height of the whole board
+ *
+ * @return {uint32_t} height
+ */
+uint32_t ConwayTiled::getHeight() const {
+    return (uint32_t)tiles_y * tile_height;
+}
+
+/**
+ * Edges published by a tile for a generation parity. Wraps or returns NULL
+ * for tiles off the board.
+ *
+ * @param  {uint8_t}    parity  generation & 1
+ * @param  {int32_t}    tile_x
+ * @param  {int32_t}    tile_y
+ * @return {uint64_t *}         edges, or NULL
+ */
+uint64_t * ConwayTiled::_edges(uint8_t parity, int32_t tile_x, int32_t tile_y) const {
+    if (tile_x < 0 || tile_x >= tiles_x || tile_y < 0 || tile_y >= tiles_y) {
+        if (!wrap) return NULL;
+
+        tile_x = (tile_x + tiles_x) % tiles_x;
+        tile_y = (tile_y + tiles_y) % tiles_y;
+    }
+
+    return edges + ((size_t)parity * tiles_x * tiles_y + (size_t)tile_y * tiles_x + tile_x) * edge_words;
+}
+
+/**
+ * Final rows of a tile
+ *
+ * @param  {uint16_t}   tile_x
+ * @param  {uint16_t}   tile_y
+ * @return {uint64_t *}         tile_height rows of row_words
+ */
+uint64_t * ConwayTiled::_result(uint16_t tile_x, uint16_t tile_y) const {
+    return results + ((size_t)tile_y * tiles_x + tile_x) * tile_height * row_words;
+}
+
+/**
+ * Step one tile for `generations`. Runs in its own process.
+ *
+ * @param  {uint16_t} tile_x
+ * @param  {uint16_t} tile_y
+ * @param  {uint32_t} seed
+ * @param  {uint32_t} generations
+ */
+void ConwayTiled::_runTile(uint16_t tile_x, uint16_t tile_y, uint32_t seed, uint32_t generations) {
+    Board * board = new Board(tile_width, tile_height);
+    ConwayPacked * board_packed = new ConwayPacked(tile_width, tile_height);
+
+    uint64_t * mine;
+    uint64_t * north;
+    uint64_t * south;
+    uint64_t * west;
+    uint64_t * east;
+    uint64_t * corner;
+    uint8_t parity;
+    bool corner_west;
+    bool corner_east;
+
+    board->reset();
+
+    for (uint8_t i_row = 0; i_row < tile_height; i_row++) {
+        for (uint8_t i_col = 0; i_col < tile_width; i_col++) {
+            if (conwayTiledSoup(seed, (uint32_t)tile_x * tile_width + i_col, (uint32_t)tile_y * tile_height + i_row)) {
+                board->setAlive(i_col, i_row);
+            }
+        }
+    }
+
+    board_packed->copyFromBoard(board);
+
+    for (uint32_t i_generation = 0; i_generation < generations; i_generation++) {
+        parity = i_generation & 1;
+
+        /**
+         * Publish edges: top row, bottom row, west column, east column
+         */
+        mine = _edges(parity, tile_x, tile_y);
+        board_packed->getRow(0, mine);
+        board_packed->getRow(tile_height - 1, mine + row_words);
+        board_packed->getColumn(0, mine + 2 * row_words);
+        board_packed->getColumn(tile_width - 1, mine + 2 * row_words + column_words);
+
+        pthread_barrier_wait(barrier);
+
+        /**
+         * Halo above is the bottom row of the tile north, corners from the
+         * tiles north west and north east. Same below.
+         */
+        north = _edges(parity, tile_x, tile_y - 1);
+        corner = _edges(parity, tile_x - 1, tile_y - 1);
+        corner_west = corner != NULL && ((corner[row_words + (tile_width - 1) / 64] >> ((tile_width - 1) % 64)) & 1);
+        corner = _edges(parity, tile_x + 1, tile_y - 1);
+        corner_east = corner != NULL && (corner[row_words] & 1);
+        board_packed->setHaloRow(false, north == NULL ? NULL : north + row_words, corner_west, corner_east);
+
+        south = _edges(parity, tile_x, tile_y + 1);
+        corner = _edges(parity, tile_x - 1, tile_y + 1);
+        corner_west = corner != NULL && ((corner[(tile_width - 1) / 64] >> ((tile_width - 1) % 64)) & 1);
+        corner = _edges(parity, tile_x + 1, tile_y + 1);
+        corner_east = corner != NULL && (corner[0] & 1);
+        board_packed->setHaloRow(true, south, corner_west, corner_east);
+
+        west = _edges(parity, tile_x - 1, tile_y);
+        board_packed->setHaloColumn(false, west == NULL ? NULL : west + 2 * row_words + column_words);
+
+        east = _edges(parity, tile_x + 1, tile_y);
+        board_packed->setHaloColumn(true, east == NULL ? NULL : east + 2 * row_words);
+
+        board_packed->step();
+        board_packed->copyToBoard(board);
+    }
+
+    for (uint8_t i_row = 0; i_row < tile_height; i_row++) {
+        board_packed->getRow(i_row, _result(tile_x, tile_y) + (size_t)i_row * row_words);
+    }
+
+    delete board_packed;
+    delete board;
+}
+
+/**
+ * Run the whole board for `generations`, one process per tile, and wait for
+ * them to finish. Needs `init` first.
+ *
+ * @param  {uint32_t} seed
+ * @param  {uint32_t} generations
+ * @return {bool}                   truth of every process succeeding
+ */
+bool ConwayTiled::run(uint32_t seed, uint32_t generations) {
+    pid_t * pids;
+    bool success = true;
+    int status;
+
+    if (shared == NULL) return false;
+
+    pids = new pid_t [tiles_x * tiles_y];
+
+    for (uint16_t tile_y = 0; tile_y < tiles_y; tile_y++) {
+        for (uint16_t tile_x = 0; tile_x < tiles_x; tile_x++) {
+            pids[tile_y * tiles_x + tile_x] = fork();
+
+            if (pids[tile_y * tiles_x + tile_x] == 0) {
+                _runTile(tile_x, tile_y, seed, generations);
+                _exit(0);
+            }
+
+            if (pids[tile_y * tiles_x + tile_x] < 0) success = false;
+        }
+    }
+
+    for (uint32_t i_tile = 0; i_tile < (uint32_t)tiles_x * tiles_y; i_tile++) {
+        if (pids[i_tile] <= 0) continue;
+
+        waitpid(pids[i_tile], &status, 0);
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) success = false;
+    }
+
+    delete [] pids;
+
+    return success;
+}
+
+/**
+ * Get if cell of the whole board is alive after `run`
+ *
+ * @param  {uint32_t} x  x coordiante
+ * @param  {uint32_t} y  y coordiante
+ * @return {bool}        truth of cell being alive
+ */
+bool ConwayTiled::getAlive(uint32_t x, uint32_t y) const {
+    const uint64_t * row = _result(x / tile_width, y / tile_height) + (size_t)(y % tile_height) * row_words;
+
+    return (row[(x % tile_width) / 64] >> ((x % tile_width) % 64)) & 1;
+}
+
+
+#endif /* ConwayTiled_h */
@@ -0,0 +1,262 @@
+#ifndef FramePipeline_h
+#define FramePipeline_h
+
+/*******************************************************************************
+ *                                  Includes                                   *
+ *******************************************************************************/
+
+#include <Arduino.h>
+
+#include <atomic>
+#include <thread>
+
+
+/*******************************************************************************
+ *                               Local Includes                                *
+ *******************************************************************************/
+
+#include "../Games/Game.h"
+
+
+/*******************************************************************************
+ *                          Frame Pipeline Settings                            *
+ *******************************************************************************/
+
+/**
+ * Frames that can be in flight between the simulation and render threads. One
+ * slot is always left empty to tell a full queue from an empty one.
+ */
+#ifndef FRAME_PIPELINE_SLOTS
+    #define FRAME_PIPELINE_SLOTS 4
+#endif /* FRAME_PIPELINE_SLOTS */
+
+/**
+ * Keep the producer and consumer positions on separate cache lines
+ */
+#ifndef FRAME_PIPELINE_CACHE_LINE
+    #define FRAME_PIPELINE_CACHE_LINE 64
+#endif /* FRAME_PIPELINE_CACHE_LINE */
+
+
+/*******************************************************************************
+ *                                Frame Queue                                  *
+ *******************************************************************************/
+
+/**
+ * Lock free single producer, single consumer ring of fixed size frames. The
+ * producer fills the slot from `acquire` then calls `publish`, the consumer
+ * reads the slot from `peek` then calls `release`. Slots are written in place
+ * so nothing is copied twice.
+ */
+class FrameQueue {
+private:
+    uint32_t frame_bytes;
+    uint8_t * frames;
+
+    /**
+     * Only the producer stores `head`, only the consumer stores `tail`
+     */
+    alignas(FRAME_PIPELINE_CACHE_LINE) std::atomic<uint32_t> head;
+    alignas(FRAME_PIPELINE_CACHE_LINE) std::atomic<uint32_t> tail;
+
+public:
+    FrameQueue(uint32_t _frame_bytes);
+    ~FrameQueue();
+
+    uint32_t getFrameBytes() const;
+
+    uint8_t * acquire();
+    void publish();
+
+    const uint8_t * peek();
+    void release();
+};
+
+
+/**
+ * Init Frame Queue
+ *
+ * @param {uint32_t} frame_bytes  size of every frame
+ */
+FrameQueue::FrameQueue(uint32_t _frame_bytes): head(0), tail(0) {
+    frame_bytes = _frame_bytes;
+    frames = new uint8_t [(uint32_t)FRAME_PIPELINE_SLOTS * frame_bytes];
+}
+
+/**
+ * Free frames
+ */
+FrameQueue::~FrameQueue() {
+    delete [] frames;
+}
+
+/**
+ * Get size of every frame
+ *
+ * @return {uint32_t} bytes
+ */
+uint32_t FrameQueue::getFrameBytes() const {
+    return frame_bytes;
+}
+
+/**
+ * Producer: get the next free slot to write
+ *
+ * @return {uint8_t *} slot, NULL if every slot is in flight
+ */
+uint8_t * FrameQueue::acquire() {
+    uint32_t i_slot = head.load(std::memory_order_relaxed);
+
+    if ((i_slot + 1) % FRAME_PIPELINE_SLOTS == tail.load(std::memory_order_acquire)) return NULL;
+
+    return frames + i_slot * frame_bytes;
+}
+
+/**
+ * Producer: hand the slot from `acquire` to the consumer
+ */
+void FrameQueue::publish() {
+    uint32_t i_slot = head.load(std::memory_order_relaxed);
+
+    head.store((i_slot + 1) % FRAME_PIPELINE_SLOTS, std::memory_order_release);
+}
+
+/**
+ * Consumer: get the oldest published frame
+ *
+ * @return {const uint8_t *} frame, NULL if none are waiting
+ */
+const uint8_t * FrameQueue::peek() {
+    uint32_t i_slot = tail.load(std::memory_order_relaxed);
+
+    if (i_slot == head.load(std::memory_order_acquire)) return NULL;
+
+    return frames + i_slot * frame_bytes;
+}
+
+/**
+ * Consumer: give the frame from `peek` back to the producer
+ */
+void FrameQueue::release() {
+    uint32_t i_slot = tail.load(std::memory_order_relaxed);
+
+    tail.store((i_slot + 1) % FRAME_PIPELINE_SLOTS, std::memory_order_release);
+}
+
+
+/*******************************************************************************
+ *                               Frame Pipeline                                *
+ *******************************************************************************/
+
+/**
+ * Called by the render thread with every frame, i.e. what `show` would send
+ */
+typedef void (*FrameSink)(const uint8_t * frame, uint32_t frame_bytes, void * context);
+
+/**
+ * Runs a game on a simulation thread and hands the drawn strip buffer of every
+ * generation to a render thread, so the next generation is computed while the
+ * last one is being sent out.
+ */
+class FramePipeline {
+private:
+    Game * game;
+    FrameQueue queue;
+
+    std::atomic<bool> simulation_done;
+
+    void _simulate(uint32_t num_frames, uint32_t generations_per_frame);
+    void _render(FrameSink sink, void * context);
+
+public:
+    FramePipeline(Game * _game);
+
+    void run(uint32_t num_frames, FrameSink sink, void * context, uint32_t generations_per_frame = 1);
+};
+
+
+/**
+ * Init Frame Pipeline
+ *
+ * @param {Game *} game  game, already `init`
+ */
+FramePipeline::FramePipeline(Game * _game):
+    queue((uint32_t)_game->getNumPixels() * GAME_PIXEL_BYTES),
+    simulation_done(false)
+{
+    game = _game;
+}
+
+/**
+ * Simulation thread: draw, queue the frame, then step the game while the frame
+ * is rendered. Waits if the render thread falls `FRAME_PIPELINE_SLOTS` behind.
+ *
+ * @param  {uint32_t} num_frames
+ * @param  {uint32_t} generations_per_frame  generations computed between frames
+ */
+void FramePipeline::_simulate(uint32_t num_frames, uint32_t generations_per_frame) {
+    uint8_t * frame;
+
+    for (uint32_t i_frame = 0; i_frame < num_frames; i_frame++) {
+        game->draw();
+
+        while ((frame = queue.acquire()) == NULL) std::this_thread::yield();
+
+        memcpy(frame, game->getPixels(), queue.getFrameBytes());
+        queue.publish();
+
+        for (uint32_t i_generation = 0; i_generation < generations_per_frame; i_generation++) {
+            game->update();
+        }
+    }
+
+    simulation_done.store(true, std::memory_order_release);
+}
+
+/**
+ * Render thread: hand every frame to `sink` in order until the simulation is
+ * done and the queue drained
+ *
+ * @param  {FrameSink} sink
+ * @param  {void *}    context  passed to `sink`
+ */
+void FramePipeline::_render(FrameSink sink, void * context) {
+    const uint8_t * frame;
+
+    while (true) {
+        frame = queue.peek();
+
+        if (frame == NULL) {
+            if (simulation_done.load(std::memory_order_acquire) && queue.peek() == NULL) break;
+
+            std::this_thread::yield();
+            continue;
+        }
+
+        sink(frame, queue.getFrameBytes(), context);
+        queue.release();
+    }
+}
+
+/**
+ * Run `num_frames` frames through the pipeline, returning once every frame
+ * has been rendered
+ *
+ * @param  {uint32_t}  num_frames
+ * @param  {FrameSink} sink
+ * @param  {void *}    context                passed to `sink`
+ * @param  {uint32_t}  generations_per_frame  generations computed between
+ *                                            frames
+ */
+void FramePipeline::run(uint32_t num_frames, FrameSink sink, void * context, uint32_t generations_per_frame) {
+    simulation_done.store(false);
+
+    std::thread render_thread(&FramePipeline::_render, this, sink, context);
+
+    _simulate(num_frames, generations_per_frame);
+
+    render_thread.join();
+}
+
+
+#endif /* FramePipeline_h */
@@ -0,0 +1,308 @@
+#ifndef FrameWriter_h
+#define FrameWriter_h
+
+/*******************************************************************************
+ *                                  Includes                                   *
+ *******************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "Adafruit_NeoMatrix.h"
+
+
+/*******************************************************************************
+ *                           Frame Writer Settings                             *
+ *******************************************************************************/
+
+/**
+ * Raw 24-bit RGB frames back to back, row by row. Plays with e.g.
+ * `ffplay -f rawvideo -pixel_format rgb24 -video_size WxH file`
+ */
+#ifndef FRAME_WRITER_RAW
+    #define FRAME_WRITER_RAW 0
+#endif /* FRAME_WRITER_RAW */
+
+/**
+ * Binary PPM (P6) per frame, back to back. Plays with e.g.
+ * `ffplay -f ppm_pipe file`
+ */
+#ifndef FRAME_WRITER_PPM
+    #define FRAME_WRITER_PPM FRAME_WRITER_RAW + 1
+#endif /* FRAME_WRITER_PPM */
+
+/**
+ * The strip buffer as is, smallest and cheapest to write. Starts with one
+ * header, all little endian:
+ *
+ *   "NEOF", version (1 byte), width, height, number of LEDs (2 bytes each),
+ *   bytes per LED, red, green, blue and white offsets (1 byte each, white 0xFF
+ *   if none), then the strip index of every pixel row by row (2 bytes each)
+ *
+ * then every frame is number of LEDs * bytes per LED.
+ */
+#ifndef FRAME_WRITER_STRIP
+    #define FRAME_WRITER_STRIP FRAME_WRITER_PPM + 1
+#endif /* FRAME_WRITER_STRIP */
+
+#define FRAME_WRITER_STRIP_VERSION 1
+
+
+/*******************************************************************************
+ *                               Frame Writer                                  *
+ *******************************************************************************/
+
+/**
+ * Writes every frame shown on a stand in NeoMatrix to a file. Each frame is
+ * put together in one buffer and written with one `fwrite`.
+ */
+class FrameWriter {
+private:
+    Adafruit_NeoMatrix * matrix;
+    FILE * file;
+    uint8_t format;
+
+    uint16_t width;
+    uint16_t height;
+
+    /**
+     * Strip index of every pixel, row by row
+     */
+    uint16_t * pixel_index;
+
+    uint8_t * frame;
+    uint32_t frame_bytes;
+    uint32_t header_bytes;
+
+    uint32_t num_frames;
+    uint64_t num_bytes;
+    double seconds;
+    bool failed;
+
+    static void _onShow(Adafruit_NeoPixel * strip, void * context);
+    bool _write(const uint8_t * data, uint32_t data_bytes);
+
+public:
+    FrameWriter(Adafruit_NeoMatrix * _matrix, FILE * _file, uint8_t _format);
+    ~FrameWriter();
+
+    void attach();
+    void detach();
+
+    bool writeFrame();
+
+    uint32_t getFrames() const;
+    uint64_t getBytes() const;
+    double getSeconds() const;
+    bool hasFailed() const;
+};
+
+
+/**
+ * Init Frame Writer. Writes the stream header straight away for
+ * FRAME_WRITER_STRIP.
+ *
+ * @param {Adafruit_NeoMatrix *} matrix
+ * @param {FILE *}               file    open for writing
+ * @param {uint8_t}              format  FRAME_WRITER_*
+ */
+FrameWriter::FrameWriter(Adafruit_NeoMatrix * _matrix, FILE * _file, uint8_t _format) {
+    uint8_t bytes_per_pixel;
+    uint8_t * header;
+    int header_length;
+    uint32_t i_pixel;
+
+    matrix = _matrix;
+    file = _file;
+    format = _format;
+
+    width = matrix->width();
+    height = matrix->height();
+    bytes_per_pixel = matrix->getBytesPerPixel();
+
+    num_frames = 0;
+    num_bytes = 0;
+    seconds = 0;
+    failed = false;
+
+    pixel_index = new uint16_t [(uint32_t)width * height];
+
+    for (i_pixel = 0; i_pixel < (uint32_t)width * height; i_pixel++) {
+        pixel_index[i_pixel] = matrix->getPixelIndex(i_pixel % width, i_pixel / width);
+    }
+
+    if (format == FRAME_WRITER_STRIP) {
+        header_bytes = 0;
+        frame_bytes = (uint32_t)matrix->numPixels() * bytes_per_pixel;
+        frame = NULL;
+
+        header = new uint8_t [16 + (uint32_t)width * height * 2];
+        memcpy(header, "NEOF", 4);
+        header[4] = FRAME_WRITER_STRIP_VERSION;
+        header[5] = width;
+        header[6] = width >> 8;
+        header[7] = height;
+        header[8] = height >> 8;
+        header[9] = matrix->numPixels();
+        header[10] = matrix->numPixels() >> 8;
+        header[11] = bytes_per_pixel;
+
+        for (uint8_t i_channel = 0; i_channel < 3; i_channel++) header[12 + i_channel] = matrix->getOffset(i_channel);
+        header[15] = bytes_per_pixel == 4 ? matrix->getOffset(3) : 0xFF;
+
+        for (i_pixel = 0; i_pixel < (uint32_t)width * height; i_pixel++) {
+            header[16 + i_pixel * 2] = pixel_index[i_pixel];
+            header[17 + i_pixel * 2] = pixel_index[i_pixel] >> 8;
+        }
+
+        _write(header, 16 + (uint32_t)width * height * 2);
+
+        delete [] header;
+        return;
+    }
+
+    /**
+     * Room for a PPM header in front of the pixels, written once and kept
+     */
+    frame_bytes = (uint32_t)width * height * 3;
+    frame = new uint8_t [32 + frame_bytes];
+
+    if (format == FRAME_WRITER_PPM) {
+        header_length = snprintf((char *)frame, 32, "P6\n%u %u\n255\n", width, height);
+        header_bytes = header_length;
+    }
+    else header_bytes = 0;
+}
+
+/**
+ * Stop writing and free buffers. Leaves the file open.
+ */
+FrameWriter::~FrameWriter() {
+    detach();
+
+    delete [] pixel_index;
+    delete [] frame;
+}
+
+/**
+ * Write a frame on every `show` of the matrix
+ */
+void FrameWriter::attach() {
+    matrix->setShowHandler(_onShow, this);
+}
+
+/**
+ * Stop writing frames on `show`
+ */
+void FrameWriter::detach() {
+    matrix->setShowHandler(NULL, NULL);
+}
+
+/**
+ * Show handler
+ *
+ * @param  {Adafruit_NeoPixel *} strip    unused, is the matrix
+ * @param  {void *}              context  FrameWriter
+ */
+void FrameWriter::_onShow(Adafruit_NeoPixel * strip, void * context) {
+    (void)strip;
+
+    ((FrameWriter *)context)->writeFrame();
+}
+
+/**
+ * Write `data` with one `fwrite`, timing it
+ *
+ * @param  {const uint8_t *} data
+ * @param  {uint32_t}        data_bytes
+ * @return {bool}                        truth of it all being written
+ */
+bool FrameWriter::_write(const uint8_t * data, uint32_t data_bytes) {
+    struct timespec started;
+    struct timespec stopped;
+    size_t written;
+
+    clock_gettime(CLOCK_MONOTONIC, &started);
+    written = fwrite(data, 1, data_bytes, file);
+    clock_gettime(CLOCK_MONOTONIC, &stopped);
+
+    seconds += (stopped.tv_sec - started.tv_sec) + (stopped.tv_nsec - started.tv_nsec) / 1e9;
+    num_bytes += written;
+
+    if (written != data_bytes) failed = true;
+
+    return written == data_bytes;
+}
+
+/**
+ * Write what the matrix is showing now as the next frame
+ *
+ * @return {bool} truth of the frame being written
+ */
+bool FrameWriter::writeFrame() {
+    const uint8_t * strip = matrix->getPixels();
+    const uint8_t * pixel;
+    uint8_t * out;
+    uint8_t bytes_per_pixel = matrix->getBytesPerPixel();
+    uint8_t r_offset = matrix->getOffset(0);
+    uint8_t g_offset = matrix->getOffset(1);
+    uint8_t b_offset = matrix->getOffset(2);
+
+    num_frames++;
+
+    if (format == FRAME_WRITER_STRIP) return _write(strip, frame_bytes);
+
+    out = frame + header_bytes;
+
+    for (uint32_t i_pixel = 0; i_pixel < (uint32_t)width * height; i_pixel++) {
+        pixel = strip + (uint32_t)pixel_index[i_pixel] * bytes_per_pixel;
+
+        *out++ = pixel[r_offset];
+        *out++ = pixel[g_offset];
+        *out++ = pixel[b_offset];
+    }
+
+    return _write(frame, header_bytes + frame_bytes);
+}
+
+/**
+ * Get number of frames written
+ *
+ * @return {uint32_t} frames
+ */
+uint32_t FrameWriter::getFrames() const {
+    return num_frames;
+}
+
+/**
+ * Get number of bytes written, headers included
+ *
+ * @return {uint64_t} bytes
+ */
+uint64_t FrameWriter::getBytes() const {
+    return num_bytes;
+}
+
+/**
+ * Get wall clock seconds spent in `fwrite`
+ *
+ * @return {double} seconds
+ */
+double FrameWriter::getSeconds() const {
+    return seconds;
+}
+
+/**
+ * Get truth of any write coming up short
+ *
+ * @return {bool} failed
+ */
+bool FrameWriter::hasFailed() const {
+    return failed;
+}
+
+
+#endif /* FrameWriter_h */
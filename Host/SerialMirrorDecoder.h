@@ -0,0 +1,368 @@
+#ifndef SerialMirrorDecoder_h
+#define SerialMirrorDecoder_h
+
+/*******************************************************************************
+ *                                  Includes                                   *
+ *******************************************************************************/
+
+#include <stdint.h>
+#include <string.h>
+
+
+/*******************************************************************************
+ *                               Local Includes                                *
+ *******************************************************************************/
+
+#include "../Games/SerialMirror.h"
+
+
+/*******************************************************************************
+ *                           Serial Mirror Decoder                             *
+ *******************************************************************************/
+
+/**
+ * Rebuilds a board from a SerialMirror stream, fed a byte at a time as it
+ * comes in. Packets that fail their checksum are dropped and the stream is
+ * searched for the next sync byte. After a dropped or missing packet deltas
+ * are ignored until the next keyframe.
+ */
+class SerialMirrorDecoder {
+private:
+    uint8_t width;
+    uint8_t height;
+
+    /**
+     * State of every cell, row by row
+     */
+    uint8_t * cells;
+
+    /**
+     * Packet being read, header first
+     */
+    uint8_t header[SERIAL_MIRROR_HEADER_BYTES];
+    uint8_t * payload;
+    uint32_t payload_bytes;
+    uint16_t payload_length;
+    uint32_t received;
+
+    bool synced;
+    uint8_t last_sequence;
+
+    uint32_t num_keyframes;
+    uint32_t num_deltas;
+    uint32_t num_errors;
+
+    void _resize(uint8_t _width, uint8_t _height);
+    bool _readRuns(const uint8_t * & in, const uint8_t * end, uint8_t * cell, uint32_t count);
+    bool _apply();
+
+public:
+    SerialMirrorDecoder();
+    ~SerialMirrorDecoder();
+
+    bool feed(uint8_t value);
+    uint32_t feed(const uint8_t * data, uint32_t data_bytes);
+
+    bool isSynced() const;
+    uint8_t getWidth() const;
+    uint8_t getHeight() const;
+    uint8_t getState(uint8_t x, uint8_t y) const;
+
+    uint32_t getKeyframes() const;
+    uint32_t getDeltas() const;
+    uint32_t getErrors() const;
+};
+
+
+/**
+ * Init Serial Mirror Decoder, with no board until the first keyframe
+ */
+SerialMirrorDecoder::SerialMirrorDecoder() {
+    width = 0;
+    height = 0;
+    cells = NULL;
+
+    payload = NULL;
+    payload_bytes = 0;
+    payload_length = 0;
+    received = 0;
+
+    synced = false;
+    last_sequence = 0;
+
+    num_keyframes = 0;
+    num_deltas = 0;
+    num_errors = 0;
+}
+
+/**
+ * Free buffers
+ */
+SerialMirrorDecoder::~SerialMirrorDecoder() {
+    delete [] cells;
+    delete [] payload;
+}
+
+/**
+ * Make room for a board of a new size
+ *
+ * @param  {uint8_t} width
+ * @param  {uint8_t} height
+ */
+void SerialMirrorDecoder::_resize(uint8_t _width, uint8_t _height) {
+    if (_width == width && _height == height && cells) return;
+
+    width = _width;
+    height = _height;
+
+    delete [] cells;
+    cells = new uint8_t [(uint32_t)width * height];
+    memset(cells, CELL_STATE_DEAD, (uint32_t)width * height);
+}
+
+/**
+ * Feed the next byte of the stream
+ *
+ * @param  {uint8_t} value
+ * @return {bool}           truth of a packet being applied
+ */
+bool SerialMirrorDecoder::feed(uint8_t value) {
+    bool applied;
+
+    if (received == 0) {
+        if (value == SERIAL_MIRROR_SYNC) header[received++] = value;
+        return false;
+    }
+
+    if (received < SERIAL_MIRROR_HEADER_BYTES) {
+        header[received++] = value;
+
+        if (received == SERIAL_MIRROR_HEADER_BYTES) {
+            payload_length = header[5] | (header[6] << 8);
+
+            /**
+             * Not a header after all, a keyframe is never longer than a byte
+             * per cell and a delta is sent as a keyframe if it would be
+             */
+            if (
+                (header[1] != SERIAL_MIRROR_KEYFRAME && header[1] != SERIAL_MIRROR_DELTA) ||
+                payload_length >= (uint32_t)header[3] * header[4] + (header[1] == SERIAL_MIRROR_KEYFRAME)
+            ) {
+                num_errors++;
+                received = 0;
+                return false;
+            }
+
+            if (payload_length > payload_bytes) {
+                delete [] payload;
+                payload_bytes = payload_length;
+                payload = new uint8_t [payload_bytes];
+            }
+        }
+
+        return false;
+    }
+
+    if (received < SERIAL_MIRROR_HEADER_BYTES + (uint32_t)payload_length) {
+        payload[received++ - SERIAL_MIRROR_HEADER_BYTES] = value;
+        return false;
+    }
+
+    /**
+     * Checksum, the last byte
+     */
+    received = 0;
+
+    for (uint8_t i_byte = 1; i_byte < SERIAL_MIRROR_HEADER_BYTES; i_byte++) value += header[i_byte];
+    for (uint16_t i_byte = 0; i_byte < payload_length; i_byte++) value += payload[i_byte];
+
+    if (value != 0) {
+        num_errors++;
+        synced = false;
+        return false;
+    }
+
+    applied = _apply();
+    if (!applied) synced = false;
+
+    return applied;
+}
+
+/**
+ * Feed a chunk of the stream
+ *
+ * @param  {const uint8_t *} data
+ * @param  {uint32_t}        data_bytes
+ * @return {uint32_t}                    number of packets applied
+ */
+uint32_t SerialMirrorDecoder::feed(const uint8_t * data, uint32_t data_bytes) {
+    uint32_t num_applied = 0;
+
+    for (uint32_t i_byte = 0; i_byte < data_bytes; i_byte++) num_applied += feed(data[i_byte]);
+
+    return num_applied;
+}
+
+/**
+ * Read runs covering `count` cells into `cell`
+ *
+ * @param  {const uint8_t * &} in     moved past the runs read
+ * @param  {const uint8_t *}   end    end of the payload
+ * @param  {uint8_t *}         cell   first cell to set
+ * @param  {uint32_t}          count  cells
+ * @return {bool}                     truth of the runs fitting exactly
+ */
+bool SerialMirrorDecoder::_readRuns(const uint8_t * & in, const uint8_t * end, uint8_t * cell, uint32_t count) {
+    uint8_t state;
+    uint32_t run;
+
+    while (count > 0) {
+        if (in >= end) return false;
+
+        state = *in >> 4;
+        run = (*in & 0x0F) + 1;
+        in++;
+
+        if (run == 16) {
+            if (in >= end) return false;
+            run += *in++;
+        }
+
+        if (run > count) return false;
+
+        memset(cell, state, run);
+        cell += run;
+        count -= run;
+    }
+
+    return true;
+}
+
+/**
+ * Apply the packet just read
+ *
+ * @return {bool} truth of it applying, false for a delta while out of sync
+ *                or one that doesn't fit the board
+ */
+bool SerialMirrorDecoder::_apply() {
+    const uint8_t * in = payload;
+    const uint8_t * end = payload + payload_length;
+    uint8_t sequence = header[2];
+    uint8_t y;
+    uint8_t x;
+    uint8_t count;
+
+    if (header[1] == SERIAL_MIRROR_KEYFRAME) {
+        _resize(header[3], header[4]);
+
+        if (!_readRuns(in, end, cells, (uint32_t)width * height) || in != end) {
+            num_errors++;
+            return false;
+        }
+
+        synced = true;
+        last_sequence = sequence;
+        num_keyframes++;
+
+        return true;
+    }
+
+    if (!synced || sequence != (uint8_t)(last_sequence + 1) || header[3] != width || header[4] != height) {
+        return false;
+    }
+
+    while (in < end) {
+        if (end - in < 3) {
+            num_errors++;
+            return false;
+        }
+
+        y = *in++;
+        x = *in++;
+        count = *in++;
+
+        if (y >= height || count == 0 || (uint16_t)x + count > width) {
+            num_errors++;
+            return false;
+        }
+
+        if (!_readRuns(in, end, cells + (uint32_t)y * width + x, count)) {
+            num_errors++;
+            return false;
+        }
+    }
+
+    last_sequence = sequence;
+    num_deltas++;
+
+    return true;
+}
+
+/**
+ * Get truth of the board matching the sender, i.e. a keyframe was received
+ * and no packet was missed since
+ *
+ * @return {bool} synced
+ */
+bool SerialMirrorDecoder::isSynced() const {
+    return synced;
+}
+
+/**
+ * Get width of the board, 0 before the first keyframe
+ *
+ * @return {uint8_t} width
+ */
+uint8_t SerialMirrorDecoder::getWidth() const {
+    return width;
+}
+
+/**
+ * Get height of the board, 0 before the first keyframe
+ *
+ * @return {uint8_t} height
+ */
+uint8_t SerialMirrorDecoder::getHeight() const {
+    return height;
+}
+
+/**
+ * Get state of cell
+ *
+ * @param  {uint8_t} x  x coordinate
+ * @param  {uint8_t} y  y coordinate
+ * @return {uint8_t}    state
+ */
+uint8_t SerialMirrorDecoder::getState(uint8_t x, uint8_t y) const {
+    return cells[(uint32_t)y * width + x];
+}
+
+/**
+ * Get number of keyframes applied
+ *
+ * @return {uint32_t} keyframes
+ */
+uint32_t SerialMirrorDecoder::getKeyframes() const {
+    return num_keyframes;
+}
+
+/**
+ * Get number of deltas applied
+ *
+ * @return {uint32_t} deltas
+ */
+uint32_t SerialMirrorDecoder::getDeltas() const {
+    return num_deltas;
+}
+
+/**
+ * Get number of packets that were malformed or failed their checksum
+ *
+ * @return {uint32_t} errors
+ */
+uint32_t SerialMirrorDecoder::getErrors() const {
+    return num_errors;
+}
+
+
+#endif /* SerialMirrorDecoder_h */
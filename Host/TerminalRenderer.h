@@ -0,0 +1,277 @@
+#ifndef TerminalRenderer_h
+#define TerminalRenderer_h
+
+/*******************************************************************************
+ *                                  Includes                                   *
+ *******************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+
+/*******************************************************************************
+ *                               Local Includes                                *
+ *******************************************************************************/
+
+#include "../Games/Game.h"
+
+
+/*******************************************************************************
+ *                        Terminal Renderer Settings                           *
+ *******************************************************************************/
+
+/**
+ * Longest escape sequence the renderer writes, a 24-bit color or cursor move
+ */
+#ifndef TERMINAL_RENDERER_ESCAPE_MAX
+    #define TERMINAL_RENDERER_ESCAPE_MAX 24
+#endif /* TERMINAL_RENDERER_ESCAPE_MAX */
+
+/**
+ * Upper half block, drawn in the top cell's color over the bottom cell's
+ */
+#define TERMINAL_RENDERER_GLYPH "\xE2\x96\x80"
+
+
+/*******************************************************************************
+ *                             Terminal Renderer                               *
+ *******************************************************************************/
+
+/**
+ * Draws a board on an ANSI terminal in 24-bit color, two rows of cells per
+ * line of text using half blocks. Only characters that changed since the last
+ * frame are written, each frame going out in one write.
+ */
+class TerminalRenderer {
+private:
+    Board * board;
+    const uint32_t * colors;
+    FILE * file;
+
+    uint8_t width;
+    uint8_t height;
+    uint8_t num_lines;
+
+    /**
+     * States of the top and bottom cell of every character as last written,
+     * 0xFFFF for unknown
+     */
+    uint16_t * shown;
+
+    /**
+     * Foreground and background escape of every state, made from
+     * `escape_colors`
+     */
+    uint32_t escape_colors[CELL_STATE_MAX + 1];
+    char (* foregrounds)[TERMINAL_RENDERER_ESCAPE_MAX];
+    char (* backgrounds)[TERMINAL_RENDERER_ESCAPE_MAX];
+
+    char * buffer;
+    uint32_t buffer_bytes;
+
+    uint32_t num_frames;
+    uint64_t num_bytes;
+
+    void _updateEscapes();
+    void _append(const char * text, uint32_t & length);
+
+public:
+    TerminalRenderer(Board * _board, const uint32_t * _colors, FILE * _file);
+    ~TerminalRenderer();
+
+    void begin();
+    void end();
+    void invalidate();
+
+    uint32_t render();
+
+    uint32_t getFrames() const;
+    uint64_t getBytes() const;
+};
+
+
+/**
+ * Init Terminal Renderer
+ *
+ * @param {Board *}          board   board to draw
+ * @param {const uint32_t *} colors  24-bit color of each state, as Game::getColors.
+ *                                   Changes are picked up on the next render.
+ * @param {FILE *}           file    terminal
+ */
+TerminalRenderer::TerminalRenderer(Board * _board, const uint32_t * _colors, FILE * _file) {
+    board = _board;
+    colors = _colors;
+    file = _file;
+
+    width = board->getWidth();
+    height = board->getHeight();
+    num_lines = (height + 1) / 2;
+
+    shown = new uint16_t [(uint16_t)width * num_lines];
+
+    foregrounds = new char [CELL_STATE_MAX + 1][TERMINAL_RENDERER_ESCAPE_MAX];
+    backgrounds = new char [CELL_STATE_MAX + 1][TERMINAL_RENDERER_ESCAPE_MAX];
+
+    /**
+     * Worst case every character needs a cursor move, both colors and a glyph
+     */
+    buffer_bytes = (uint32_t)width * num_lines * (3 * TERMINAL_RENDERER_ESCAPE_MAX + sizeof(TERMINAL_RENDERER_GLYPH)) + 64;
+    buffer = new char [buffer_bytes];
+
+    num_frames = 0;
+    num_bytes = 0;
+
+    _updateEscapes();
+    invalidate();
+}
+
+/**
+ * Free buffers
+ */
+TerminalRenderer::~TerminalRenderer() {
+    delete [] shown;
+    delete [] foregrounds;
+    delete [] backgrounds;
+    delete [] buffer;
+}
+
+/**
+ * Clear the terminal and hide the cursor
+ */
+void TerminalRenderer::begin() {
+    fputs("\x1b[?25l\x1b[2J", file);
+    fflush(file);
+
+    invalidate();
+}
+
+/**
+ * Reset colors, move below the board and show the cursor again
+ */
+void TerminalRenderer::end() {
+    fprintf(file, "\x1b[0m\x1b[%u;1H\x1b[?25h", num_lines + 1);
+    fflush(file);
+}
+
+/**
+ * Forget what is on the terminal, so the next frame is drawn in full, e.g.
+ * after it was resized or written to by something else
+ */
+void TerminalRenderer::invalidate() {
+    memset(shown, 0xFF, (uint32_t)width * num_lines * sizeof(uint16_t));
+}
+
+/**
+ * Make the color escapes of every state from `colors`
+ */
+void TerminalRenderer::_updateEscapes() {
+    for (uint8_t state = 0; state <= CELL_STATE_MAX; state++) {
+        escape_colors[state] = colors[state];
+
+        snprintf(foregrounds[state], TERMINAL_RENDERER_ESCAPE_MAX, "\x1b[38;2;%u;%u;%um",
+            (uint8_t)(colors[state] >> 16), (uint8_t)(colors[state] >> 8), (uint8_t)colors[state]);
+        snprintf(backgrounds[state], TERMINAL_RENDERER_ESCAPE_MAX, "\x1b[48;2;%u;%u;%um",
+            (uint8_t)(colors[state] >> 16), (uint8_t)(colors[state] >> 8), (uint8_t)colors[state]);
+    }
+}
+
+/**
+ * Append `text` to the frame
+ *
+ * @param  {const char *} text
+ * @param  {uint32_t &}   length  of the frame so far, moved on
+ */
+void TerminalRenderer::_append(const char * text, uint32_t & length) {
+    while (*text) buffer[length++] = *text++;
+}
+
+/**
+ * Draw the board as it is now, writing only the characters that changed
+ *
+ * @return {uint32_t} bytes written
+ */
+uint32_t TerminalRenderer::render() {
+    uint32_t length = 0;
+    uint16_t * cell = shown;
+    uint16_t states;
+    uint8_t top;
+    uint8_t bottom;
+    uint8_t i_line;
+    uint8_t i_col;
+    char move[TERMINAL_RENDERER_ESCAPE_MAX];
+
+    /**
+     * Where the cursor is and which colors are set, 0xFF for unknown
+     */
+    uint8_t cursor_line = 0xFF;
+    uint8_t cursor_col = 0xFF;
+    uint8_t foreground = 0xFF;
+    uint8_t background = 0xFF;
+
+    /**
+     * Colors changed, e.g. on a new round, so every character is stale
+     */
+    if (memcmp(escape_colors, colors, sizeof(escape_colors)) != 0) {
+        _updateEscapes();
+        invalidate();
+    }
+
+    for (i_line = 0; i_line < num_lines; i_line++) {
+        for (i_col = 0; i_col < width; i_col++, cell++) {
+            top = board->getState(i_col, i_line * 2);
+            bottom = i_line * 2 + 1 < height ? board->getState(i_col, i_line * 2 + 1) : CELL_STATE_DEAD;
+            states = ((uint16_t)top << 8) | bottom;
+
+            if (*cell == states) continue;
+            *cell = states;
+
+            if (cursor_line != i_line || cursor_col != i_col) {
+                snprintf(move, sizeof(move), "\x1b[%u;%uH", i_line + 1, i_col + 1);
+                _append(move, length);
+            }
+
+            if (foreground != top) _append(foregrounds[top], length);
+            if (background != bottom) _append(backgrounds[bottom], length);
+
+            _append(TERMINAL_RENDERER_GLYPH, length);
+
+            foreground = top;
+            background = bottom;
+            cursor_line = i_line;
+            cursor_col = i_col + 1;
+        }
+    }
+
+    num_frames++;
+
+    if (length == 0) return 0;
+
+    fwrite(buffer, 1, length, file);
+    fflush(file);
+
+    num_bytes += length;
+
+    return length;
+}
+
+/**
+ * Get number of frames rendered
+ *
+ * @return {uint32_t} frames
+ */
+uint32_t TerminalRenderer::getFrames() const {
+    return num_frames;
+}
+
+/**
+ * Get number of bytes written, not counting `begin` and `end`
+ *
+ * @return {uint64_t} bytes
+ */
+uint64_t TerminalRenderer::getBytes() const {
+    return num_bytes;
+}
+
+
+#endif /* TerminalRenderer_h */
@@ -0,0 +1,401 @@
+/**
+ * Time the hot paths of Board, Conway and LangstonsAnt across board sizes and
+ * print the results as JSON.
+ *
+ *   benchmark_<variant> [milliseconds_per_case] [max_size]
+ *
+ * Cell width is compile time, so each variant is its own executable built
+ * with a different CELLS_PER_BYTE, see CMakeLists.txt. The game settings are
+ * template policies, so every variant runs each policy below side by side,
+ * named in `policy`, `default` being the one the settings give. Sizes go from 8x8
+ * up to `max_size`, at most 248 as boards are at most 255 cells wide and the
+ * width must be a multiple of CELLS_PER_BYTE. The game cases stop at the
+ * largest panel whose strip fits the library's 16 bit byte count, 128x128 at
+ * 3 bytes a pixel, the board cases go on to 248x248. `bytes` is the heap
+ * measured, `sram_bytes` what Sram.h works out for the same, the whole game
+ * for the game cases, at host sizes. Collect every variant with e.g.
+ *
+ *   for b in build/benchmark_*; do $b; done > benchmarks.json
+ */
+
+#include <Arduino.h>
+
+#include <new>
+#include <time.h>
+
+#include "../Games/Conway.h"
+#include "../Games/LangstonsAnt.h"
+
+
+#ifndef BENCHMARK_VARIANT
+    #define BENCHMARK_VARIANT "default"
+#endif /* BENCHMARK_VARIANT */
+
+
+/*******************************************************************************
+ *                                Heap Counting                                *
+ *******************************************************************************/
+
+/**
+ * Bytes live on the heap, kept by replacing the global `new` and `delete`
+ * with ones that store the size in front of each block
+ */
+static size_t heap_bytes = 0;
+
+static const size_t heap_header_bytes = 16;
+
+/**
+ * Allocate `size` bytes behind a header holding the size. Kept out of line,
+ * so the compiler doesn't see the `malloc` and `free` under `new` and
+ * `delete` and warn about them being mismatched.
+ *
+ * @param  {size_t} size
+ * @return {void *}
+ */
+static __attribute__((noinline)) void * _heapAllocate(size_t size) {
+    uint8_t * block = (uint8_t *)malloc(size + heap_header_bytes);
+
+    if (!block) throw std::bad_alloc();
+
+    *(size_t *)block = size;
+    heap_bytes += size;
+
+    return block + heap_header_bytes;
+}
+
+/**
+ * Free what `_heapAllocate` returned, NULL included
+ *
+ * @param  {void *} pointer
+ */
+static __attribute__((noinline)) void _heapFree(void * pointer) {
+    uint8_t * block;
+
+    if (!pointer) return;
+
+    block = (uint8_t *)pointer - heap_header_bytes;
+    heap_bytes -= *(size_t *)block;
+
+    free(block);
+}
+
+void * operator new(size_t size) {
+    return _heapAllocate(size);
+}
+
+void * operator new[](size_t size) {
+    return _heapAllocate(size);
+}
+
+void operator delete(void * pointer) noexcept {
+    _heapFree(pointer);
+}
+
+void operator delete[](void * pointer) noexcept {
+    _heapFree(pointer);
+}
+
+/**
+ * Sized forms, which C++14 calls when the size is known. The size kept in the
+ * header is what counts.
+ */
+void operator delete(void * pointer, size_t) noexcept {
+    _heapFree(pointer);
+}
+
+void operator delete[](void * pointer, size_t) noexcept {
+    _heapFree(pointer);
+}
+
+
+/*******************************************************************************
+ *                                  Timing                                     *
+ *******************************************************************************/
+
+/**
+ * Nanoseconds on the wall clock
+ *
+ * @return {double} nanoseconds
+ */
+static double now() {
+    struct timespec time;
+
+    clock_gettime(CLOCK_MONOTONIC, &time);
+
+    return time.tv_sec * 1e9 + time.tv_nsec;
+}
+
+/**
+ * Result of one case
+ */
+struct Measurement {
+    uint32_t iterations;
+    double nanoseconds;
+};
+
+/**
+ * Run `step` in batches until `milliseconds` have gone by, after one batch to
+ * warm up
+ *
+ * @param  {Step &}   step          callable, one iteration per call
+ * @param  {uint32_t} milliseconds
+ * @return {Measurement}
+ */
+template <class Step>
+static Measurement measure(Step & step, uint32_t milliseconds) {
+    Measurement measurement;
+    uint32_t batch = 1;
+    double started;
+
+    step();
+
+    measurement.iterations = 0;
+    measurement.nanoseconds = 0;
+
+    while (measurement.nanoseconds < milliseconds * 1e6) {
+        started = now();
+        for (uint32_t i_iteration = 0; i_iteration < batch; i_iteration++) step();
+        measurement.nanoseconds += now() - started;
+
+        measurement.iterations += batch;
+        if (batch < (1 << 20)) batch *= 2;
+    }
+
+    return measurement;
+}
+
+
+/*******************************************************************************
+ *                                   Output                                    *
+ *******************************************************************************/
+
+static bool first_result = true;
+
+/**
+ * Print one result as a JSON object
+ *
+ * @param  {const char *} name
+ * @param  {const char *} policy        game settings, see the policies below
+ * @param  {uint8_t}      size          width and height
+ * @param  {Measurement}  measurement
+ * @param  {size_t}       bytes         heap used by what was measured
+ * @param  {uint32_t}     sram_bytes    SRAM the model in Sram.h gives it
+ */
+static void printResult(const char * name, const char * policy, uint8_t size, Measurement measurement, size_t bytes, uint32_t sram_bytes) {
+    double ns_per_iteration = measurement.nanoseconds / measurement.iterations;
+
+    printf("%s\n    {\"benchmark\": \"%s\", \"policy\": \"%s\", \"width\": %u, \"height\": %u, \"iterations\": %u, "
+        "\"ns_per_iteration\": %.3f, \"ns_per_cell\": %.4f, \"bytes\": %zu, \"sram_bytes\": %u}",
+        first_result ? "" : ",",
+        name, policy, size, size, measurement.iterations,
+        ns_per_iteration, ns_per_iteration / ((uint32_t)size * size), bytes, sram_bytes);
+
+    first_result = false;
+}
+
+/**
+ * Print the settings the variant was built with
+ */
+static void printConfig() {
+    printf("  \"config\": {\"CELLS_PER_BYTE\": %u, \"CELL_WIDTH\": %u, \"BOARD_TRACK_DIRTY\": %s, "
+        "\"CONWAY_PACKED_KERNEL\": %s, \"CONWAY_CHECKING_BOARD_MINIMIZE\": %s, "
+        "\"CONWAY_CHECKING_BOARD_USE_STACK\": %s, \"CONWAY_ASSIGN_DENSITY\": %s},\n",
+        (unsigned)CELLS_PER_BYTE, (unsigned)(CELL_WIDTH),
+        BOARD_TRACK_DIRTY ? "true" : "false",
+        CONWAY_PACKED_KERNEL ? "true" : "false",
+        CONWAY_CHECKING_BOARD_MINIMIZE ? "true" : "false",
+        CONWAY_CHECKING_BOARD_USE_STACK ? "true" : "false",
+        CONWAY_ASSIGN_DENSITY ? "true" : "false");
+}
+
+
+/*******************************************************************************
+ *                                 Benchmarks                                  *
+ *******************************************************************************/
+
+/**
+ * Sum is kept so reads aren't optimized away
+ */
+static volatile uint32_t sink;
+
+/**
+ * Read every cell of a random board
+ */
+static void benchmarkGetState(uint8_t size, uint32_t milliseconds) {
+    size_t heap_before = heap_bytes;
+    Board * board = new Board(size, size);
+    size_t bytes = heap_bytes - heap_before;
+
+    board->randomize();
+
+    auto step = [&]() {
+        uint32_t sum = 0;
+
+        for (uint8_t y = 0; y < size; y++) {
+            for (uint8_t x = 0; x < size; x++) sum += board->getState(x, y);
+        }
+
+        sink = sink + sum;
+    };
+
+    printResult("board_get_state", "default", size, measure(step, milliseconds), bytes, sizeof(Board) + Board::sramBytes(size, size));
+
+    delete board;
+}
+
+/**
+ * Write every cell, flipping the pattern each pass so every write changes
+ * the cell
+ */
+static void benchmarkSetState(uint8_t size, uint32_t milliseconds) {
+    size_t heap_before = heap_bytes;
+    Board * board = new Board(size, size);
+    size_t bytes = heap_bytes - heap_before;
+    uint8_t phase = 0;
+
+    auto step = [&]() {
+        for (uint8_t y = 0; y < size; y++) {
+            for (uint8_t x = 0; x < size; x++) board->setState(x, y, (x + y + phase) & 1);
+        }
+
+        phase++;
+    };
+
+    printResult("board_set_state", "default", size, measure(step, milliseconds), bytes, sizeof(Board) + Board::sramBytes(size, size));
+
+    delete board;
+}
+
+/**
+ * Draw a random soup over the whole board, as a new round does
+ */
+static void benchmarkRandomize(uint8_t size, uint32_t milliseconds) {
+    size_t heap_before = heap_bytes;
+    Board * board = new Board(size, size);
+    size_t bytes = heap_bytes - heap_before;
+
+    auto step = [&]() {
+        sink = sink + board->randomize();
+    };
+
+    printResult("board_randomize", "default", size, measure(step, milliseconds), bytes, sizeof(Board) + Board::sramBytes(size, size));
+
+    delete board;
+}
+
+/**
+ * Step a random Conway soup set by policy `P`, new rounds included as they
+ * come
+ */
+template <class P>
+static void benchmarkConway(const char * policy, uint8_t size, uint32_t milliseconds) {
+    size_t heap_before = heap_bytes;
+    ConwayT<P> * game = new ConwayT<P>(size, size, 1, 1, 6);
+    size_t bytes;
+
+    game->init();
+    bytes = heap_bytes - heap_before;
+
+    auto step = [&]() {
+        game->update();
+    };
+
+    printResult("conway_update", policy, size, measure(step, milliseconds), bytes, ConwayT<P>::sram(size, size, 1, 1).total());
+
+    delete game;
+}
+
+/**
+ * Step Langston's ant set by policy `P`
+ */
+template <class P>
+static void benchmarkLangstonsAnt(const char * policy, uint8_t size, uint32_t milliseconds) {
+    size_t heap_before = heap_bytes;
+    LangstonsAntT<P> * game = new LangstonsAntT<P>(size, size, 1, 1, 6);
+    size_t bytes;
+
+    game->init();
+    bytes = heap_bytes - heap_before;
+
+    auto step = [&]() {
+        game->update();
+    };
+
+    printResult("langstons_ant_update", policy, size, measure(step, milliseconds), bytes, LangstonsAntT<P>::sram(size, size, 1, 1).total());
+
+    delete game;
+}
+
+
+/*******************************************************************************
+ *                                  Policies                                   *
+ *******************************************************************************/
+
+/**
+ * Conway by checking board, checks and kernel. Density follows the setting so
+ * the 1 bit variant builds.
+ */
+typedef ConwayPolicy<BoardAnnex, false, true, true, CONWAY_ASSIGN_DENSITY> ConwayAnnexPolicy;
+typedef ConwayPolicy<BoardAnnexStack, false, true, true, CONWAY_ASSIGN_DENSITY> ConwayStackPolicy;
+typedef ConwayPolicy<Board, false, true, true, CONWAY_ASSIGN_DENSITY> ConwayFullPolicy;
+typedef ConwayPolicy<BoardAnnex, false, true, false, CONWAY_ASSIGN_DENSITY> ConwayAnnexNoCyclePolicy;
+typedef ConwayPolicy<BoardAnnex, false, false, false, CONWAY_ASSIGN_DENSITY> ConwayAnnexNoChecksPolicy;
+typedef ConwayPolicy<BoardAnnex, false, true, true, false> ConwayAnnexNoDensityPolicy;
+typedef ConwayPolicy<BoardAnnex, true, true, true, CONWAY_ASSIGN_DENSITY> ConwayPackedPolicy;
+typedef ConwayPolicy<BoardAnnex, true, true, false, CONWAY_ASSIGN_DENSITY> ConwayPackedNoCyclePolicy;
+
+/**
+ * Langston's ant by number of ants and how they move
+ */
+typedef LangstonsAntPolicy<1, true> AntParallelPolicy;
+typedef LangstonsAntPolicy<1, false> AntSerialPolicy;
+typedef LangstonsAntPolicy<8, true> AntParallel8Policy;
+
+/**
+ * Every game case at one size
+ */
+static void benchmarkGames(uint8_t size, uint32_t milliseconds) {
+    benchmarkConway<ConwayPolicy<> >("default", size, milliseconds);
+    benchmarkConway<ConwayAnnexPolicy>("annex", size, milliseconds);
+    benchmarkConway<ConwayStackPolicy>("stack", size, milliseconds);
+    benchmarkConway<ConwayFullPolicy>("full", size, milliseconds);
+    benchmarkConway<ConwayAnnexNoCyclePolicy>("annex_no_cycle", size, milliseconds);
+    benchmarkConway<ConwayAnnexNoChecksPolicy>("annex_no_checks", size, milliseconds);
+    benchmarkConway<ConwayAnnexNoDensityPolicy>("annex_no_density", size, milliseconds);
+    benchmarkConway<ConwayPackedPolicy>("packed", size, milliseconds);
+    benchmarkConway<ConwayPackedNoCyclePolicy>("packed_no_cycle", size, milliseconds);
+
+    benchmarkLangstonsAnt<LangstonsAntPolicy<> >("default", size, milliseconds);
+    benchmarkLangstonsAnt<AntParallelPolicy>("parallel", size, milliseconds);
+    benchmarkLangstonsAnt<AntSerialPolicy>("serial", size, milliseconds);
+    benchmarkLangstonsAnt<AntParallel8Policy>("parallel_8_ants", size, milliseconds);
+}
+
+int main(int argc, char ** argv) {
+    uint32_t milliseconds  = argc > 1 ? atol(argv[1]) : 100;
+    uint16_t max_size      = argc > 2 ? atoi(argv[2]) : 248;
+
+    static const uint8_t sizes[] = { 8, 16, 32, 64, 128, 248 };
+
+    printf("{\n  \"variant\": \"%s\",\n", BENCHMARK_VARIANT);
+    printConfig();
+    printf("  \"results\": [");
+
+    for (uint8_t i_size = 0; i_size < sizeof(sizes); i_size++) {
+        if (sizes[i_size] > max_size) break;
+
+        benchmarkGetState(sizes[i_size], milliseconds);
+        benchmarkSetState(sizes[i_size], milliseconds);
+        benchmarkRandomize(sizes[i_size], milliseconds);
+
+        if ((uint32_t)sizes[i_size] * sizes[i_size] * GAME_PIXEL_BYTES <= 0xFFFF) {
+            benchmarkGames(sizes[i_size], milliseconds);
+        }
+
+        fflush(stdout);
+    }
+
+    printf("\n  ]\n}\n");
+
+    return 0;
+}
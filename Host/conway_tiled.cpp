@@ -0,0 +1,197 @@
+/**
+ * Run one Conway board split into tiles across local processes, then check it
+ * against the same board stepped by a single ConwayPacked, or by a cell by
+ * cell torus when wrapping.
+ *
+ *   conway_tiled [tiles_x] [tiles_y] [tile_width] [tile_height] [generations]
+ *                [seed] [wrap]
+ */
+
+#include <Arduino.h>
+
+#include <time.h>
+
+#include "ConwayTiled.h"
+
+
+/**
+ * Seconds on the wall clock
+ *
+ * @return {double} seconds
+ */
+static double now() {
+    struct timespec time;
+
+    clock_gettime(CLOCK_MONOTONIC, &time);
+
+    return time.tv_sec + time.tv_nsec / 1e9;
+}
+
+/**
+ * Step a board wrapped around at its edges one generation, cell by cell. The
+ * reference for wrapping, as ConwayPacked has no wrap.
+ *
+ * @param  {const uint8_t *} cells   width * height, 1 for alive
+ * @param  {uint8_t *}       next    width * height, gets the next generation
+ * @param  {uint32_t}        width
+ * @param  {uint32_t}        height
+ */
+static void stepTorus(const uint8_t * cells, uint8_t * next, uint32_t width, uint32_t height) {
+    uint8_t num_neighbors;
+
+    for (uint32_t i_row = 0; i_row < height; i_row++) {
+        for (uint32_t i_col = 0; i_col < width; i_col++) {
+            num_neighbors = 0;
+
+            for (uint32_t d_row = height - 1; d_row <= height + 1; d_row++) {
+                for (uint32_t d_col = width - 1; d_col <= width + 1; d_col++) {
+                    if (d_row == height && d_col == width) continue;
+
+                    num_neighbors += cells[((i_row + d_row) % height) * width + (i_col + d_col) % width];
+                }
+            }
+
+            next[i_row * width + i_col] = num_neighbors == 3 || (num_neighbors == 2 && cells[i_row * width + i_col]);
+        }
+    }
+}
+
+int main(int argc, char ** argv) {
+    long tiles_x         = argc > 1 ? atol(argv[1]) : 2;
+    long tiles_y         = argc > 2 ? atol(argv[2]) : 2;
+    long tile_width      = argc > 3 ? atol(argv[3]) : 128;
+    long tile_height     = argc > 4 ? atol(argv[4]) : 128;
+    uint32_t generations = argc > 5 ? atol(argv[5]) : 1000;
+    uint32_t seed        = argc > 6 ? atol(argv[6]) : 1;
+    bool wrap            = argc > 7 ? atoi(argv[7]) != 0 : false;
+
+    uint32_t width;
+    uint32_t height;
+    uint32_t num_different = 0;
+    uint32_t population = 0;
+    bool checked = false;
+    double started;
+    double tiled_seconds;
+    double single_seconds;
+
+    if (tiles_x < 1 || tiles_x > 0xFFFF || tiles_y < 1 || tiles_y > 0xFFFF) {
+        printf("tiles must be 1 to 65535 in each direction\n");
+        return 1;
+    }
+
+    if (tile_width < 1 || tile_width > 0xFF || tile_height < 1 || tile_height > 0xFF) {
+        printf("tiles must be 1 to 255 cells in each direction\n");
+        return 1;
+    }
+
+    if (tile_width % CELLS_PER_BYTE) {
+        printf("tile width must be a multiple of %u\n", CELLS_PER_BYTE);
+        return 1;
+    }
+
+    ConwayTiled tiled(tiles_x, tiles_y, tile_width, tile_height, wrap);
+
+    if (!tiled.init()) return 1;
+
+    width = tiled.getWidth();
+    height = tiled.getHeight();
+
+    printf("board %ux%u, %lux%lu tiles of %lux%lu, %u generations\n",
+        width, height, tiles_x, tiles_y, tile_width, tile_height, generations);
+
+    started = now();
+    if (!tiled.run(seed, generations)) {
+        printf("a tile process failed\n");
+        return 1;
+    }
+    tiled_seconds = now() - started;
+
+    /**
+     * Reference when wrapping: the whole board as a torus, one byte a cell
+     */
+    if (wrap) {
+        uint8_t * cells = new uint8_t [(size_t)width * height];
+        uint8_t * next = new uint8_t [(size_t)width * height];
+        uint8_t * swap;
+
+        for (uint32_t i_row = 0; i_row < height; i_row++) {
+            for (uint32_t i_col = 0; i_col < width; i_col++) {
+                cells[(size_t)i_row * width + i_col] = conwayTiledSoup(seed, i_col, i_row);
+            }
+        }
+
+        started = now();
+        for (uint32_t i_generation = 0; i_generation < generations; i_generation++) {
+            stepTorus(cells, next, width, height);
+
+            swap = cells;
+            cells = next;
+            next = swap;
+        }
+        single_seconds = now() - started;
+
+        for (uint32_t i_row = 0; i_row < height; i_row++) {
+            for (uint32_t i_col = 0; i_col < width; i_col++) {
+                if ((bool)cells[(size_t)i_row * width + i_col] != tiled.getAlive(i_col, i_row)) {
+                    if (num_different == 0) printf("first difference at (%u, %u)\n", i_col, i_row);
+
+                    num_different++;
+                }
+            }
+        }
+
+        printf("torus reference: %.3fs, %.1f Mcells/s\n",
+            single_seconds, (double)width * height * generations / single_seconds / 1e6);
+
+        delete [] next;
+        delete [] cells;
+
+        checked = true;
+    }
+
+    /**
+     * Reference otherwise: the whole board in one packed board, as long as
+     * it fits one
+     */
+    else if (width <= 0xFFFF && height <= 0xFFFD) {
+        ConwayPacked single = ConwayPacked(width, height);
+
+        for (uint32_t i_row = 0; i_row < height; i_row++) {
+            for (uint32_t i_col = 0; i_col < width; i_col++) {
+                if (conwayTiledSoup(seed, i_col, i_row)) single.setAlive(i_col, i_row);
+            }
+        }
+
+        started = now();
+        for (uint32_t i_generation = 0; i_generation < generations; i_generation++) {
+            single.step();
+            single.copyToBoard(NULL);
+        }
+        single_seconds = now() - started;
+
+        for (uint32_t i_row = 0; i_row < height; i_row++) {
+            for (uint32_t i_col = 0; i_col < width; i_col++) {
+                if (single.getAlive(i_col, i_row) != tiled.getAlive(i_col, i_row)) {
+                    if (num_different == 0) printf("first difference at (%u, %u)\n", i_col, i_row);
+
+                    num_different++;
+                }
+            }
+        }
+
+        printf("single process: %.3fs, %.1f Mcells/s, kernel %s\n",
+            single_seconds, (double)width * height * generations / single_seconds / 1e6, ConwayPacked::getKernelName());
+
+        checked = true;
+    }
+
+    for (uint32_t i_row = 0; i_row < height; i_row++) {
+        for (uint32_t i_col = 0; i_col < width; i_col++) population += tiled.getAlive(i_col, i_row);
+    }
+
+    printf("tiled:          %.3fs, %.1f Mcells/s\n", tiled_seconds, (double)width * height * generations / tiled_seconds / 1e6);
+    if (checked) printf("population %u, %u cells differ\n", population, num_different);
+    else printf("population %u, not checked, the board is too big for a single packed board\n", population);
+
+    return num_different == 0 ? 0 : 1;
+}
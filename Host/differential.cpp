@@ -0,0 +1,393 @@
+/**
+ * Run the reference Conway and Langston's ant next to the other engines that
+ * should play the same, and check they do generation by generation.
+ *
+ *   differential_<variant> [generations] [num_seeds]
+ *
+ * Every engine of a group below is seeded the same on each size and stepped
+ * with `update` in lock step with the group's reference, the first engine. A
+ * board hash, generation or population that differs from the reference is
+ * reported with the cells around it and the case stops there, exiting 1 in the
+ * end. Each engine's `update` is timed on the way, so a table of nanoseconds a
+ * generation and speed up on the reference follows.
+ *
+ * Cell width is compile time, so as with the benchmark each variant is its own
+ * executable, see CMakeLists.txt. A new engine goes in a group here to be
+ * checked against the reference.
+ */
+
+#include <Arduino.h>
+
+#include <time.h>
+
+#include "../Games/Conway.h"
+#include "../Games/LangstonsAnt.h"
+
+
+#ifndef DIFFERENTIAL_VARIANT
+    #define DIFFERENTIAL_VARIANT "default"
+#endif /* DIFFERENTIAL_VARIANT */
+
+/**
+ * Columns and rows of cells shown around the first difference, and cells
+ * that differ listed at most
+ */
+#define DIFFERENTIAL_DIFF_COLUMNS 32
+#define DIFFERENTIAL_DIFF_ROWS 16
+#define DIFFERENTIAL_DIFF_LISTED 16
+
+
+/*******************************************************************************
+ *                                   Engines                                   *
+ *******************************************************************************/
+
+/**
+ * Nanoseconds on the wall clock
+ *
+ * @return {double} nanoseconds
+ */
+static double now() {
+    struct timespec time;
+
+    clock_gettime(CLOCK_MONOTONIC, &time);
+
+    return time.tv_sec * 1e9 + time.tv_nsec;
+}
+
+/**
+ * One way of playing a game, made fresh for each size and seed
+ */
+struct Engine {
+    const char * name;
+    Game * (* create)(uint8_t width, uint8_t height);
+    void (* destroy)(Game * game);
+};
+
+template <class G>
+static Game * createGame(uint8_t width, uint8_t height) {
+    return new G(width, height, 1, 1, 6);
+}
+
+template <class G>
+static void destroyGame(Game * game) {
+    delete (G *)game;
+}
+
+/**
+ * Engine playing game `G`
+ *
+ * @param  {const char *} name
+ * @return {Engine}
+ */
+template <class G>
+static Engine engine(const char * name) {
+    Engine _engine = { name, createGame<G>, destroyGame<G> };
+
+    return _engine;
+}
+
+/**
+ * Engines that play a seed the same, the first being the reference
+ */
+struct Group {
+    const char * name;
+    uint8_t num_engines;
+    Engine engines[4];
+};
+
+/**
+ * Conway with the full checking board as the reference, as it keeps the
+ * whole next generation before comparing it. Density follows the setting so
+ * the 1 bit variant builds.
+ */
+typedef ConwayPolicy<Board, false, true, true, CONWAY_ASSIGN_DENSITY> ConwayFullPolicy;
+typedef ConwayPolicy<BoardAnnex, false, true, true, CONWAY_ASSIGN_DENSITY> ConwayAnnexPolicy;
+typedef ConwayPolicy<BoardAnnexStack, false, true, true, CONWAY_ASSIGN_DENSITY> ConwayStackPolicy;
+typedef ConwayPolicy<BoardAnnex, true, true, true, CONWAY_ASSIGN_DENSITY> ConwayPackedPolicy;
+
+typedef ConwayPolicy<Board, false, true, false, CONWAY_ASSIGN_DENSITY> ConwayFullNoCyclePolicy;
+typedef ConwayPolicy<BoardAnnex, false, true, false, CONWAY_ASSIGN_DENSITY> ConwayAnnexNoCyclePolicy;
+typedef ConwayPolicy<BoardAnnex, true, true, false, CONWAY_ASSIGN_DENSITY> ConwayPackedNoCyclePolicy;
+
+/**
+ * A single ant moves the same in parallel as on its own
+ */
+typedef LangstonsAntPolicy<1, false> AntSerialPolicy;
+typedef LangstonsAntPolicy<1, true> AntParallelPolicy;
+
+static const Group groups[] = {
+    { "conway", 4, {
+        engine<ConwayT<ConwayFullPolicy> >("full"),
+        engine<ConwayT<ConwayAnnexPolicy> >("annex"),
+        engine<ConwayT<ConwayStackPolicy> >("stack"),
+        engine<ConwayT<ConwayPackedPolicy> >("packed")
+    } },
+    { "conway_no_cycle", 3, {
+        engine<ConwayT<ConwayFullNoCyclePolicy> >("full"),
+        engine<ConwayT<ConwayAnnexNoCyclePolicy> >("annex"),
+        engine<ConwayT<ConwayPackedNoCyclePolicy> >("packed")
+    } },
+    { "langstons_ant", 2, {
+        engine<LangstonsAntT<AntSerialPolicy> >("serial"),
+        engine<LangstonsAntT<AntParallelPolicy> >("parallel")
+    } }
+};
+
+#define DIFFERENTIAL_NUM_GROUPS (sizeof(groups) / sizeof(groups[0]))
+
+/**
+ * Board sizes, widths a multiple of every CELLS_PER_BYTE. Odd ones so partial
+ * packed words and edges get played too.
+ */
+static const uint8_t sizes[][2] = {
+    {   8,   8 },
+    {  16,   8 },
+    {  24,  40 },
+    {  64,  64 },
+    {  72,  33 },
+    { 128, 128 }
+};
+
+#define DIFFERENTIAL_NUM_SIZES (sizeof(sizes) / sizeof(sizes[0]))
+
+
+/*******************************************************************************
+ *                                 Comparing                                   *
+ *******************************************************************************/
+
+/**
+ * Character a cell is shown as
+ *
+ * @param  {uint8_t} state
+ * @return {char}
+ */
+static char cellChar(uint8_t state) {
+    return state == CELL_STATE_DEAD ? '.' : "0123456789abcdef"[state & 0x0F];
+}
+
+/**
+ * First of `count` out of `size` centered on `at`
+ *
+ * @param  {uint8_t}  at
+ * @param  {uint8_t}  size
+ * @param  {uint8_t}  count
+ * @return {uint8_t}        first
+ */
+static uint8_t windowFrom(uint8_t at, uint8_t size, uint8_t count) {
+    if (size <= count || at < count / 2) return 0;
+    if (at - count / 2 + count > size) return size - count;
+
+    return at - count / 2;
+}
+
+/**
+ * Print the cells of both boards around the first one that differs, a row of
+ * each at a time, the engine's marked where it differs
+ *
+ * @param  {Board *}      reference
+ * @param  {Board *}      board
+ * @param  {const char *} name       of the engine
+ */
+static void printCellDiff(Board * reference, Board * board, const char * name) {
+    uint8_t width = reference->getWidth();
+    uint8_t height = reference->getHeight();
+    uint8_t x_first = 0;
+    uint8_t y_first = 0;
+    uint16_t num_differ = 0;
+    uint8_t x_from;
+    uint8_t x_to;
+    uint8_t y_from;
+    uint8_t y_to;
+
+    for (uint8_t y = 0; y < height; y++) {
+        for (uint8_t x = 0; x < width; x++) {
+            if (reference->getState(x, y) == board->getState(x, y)) continue;
+
+            if (!num_differ) {
+                x_first = x;
+                y_first = y;
+            }
+
+            num_differ++;
+        }
+    }
+
+    if (!num_differ) {
+        printf("    cells are the same, the counts differ\n");
+        return;
+    }
+
+    x_from = windowFrom(x_first, width, DIFFERENTIAL_DIFF_COLUMNS);
+    x_to = width - x_from > DIFFERENTIAL_DIFF_COLUMNS ? x_from + DIFFERENTIAL_DIFF_COLUMNS : width;
+    y_from = windowFrom(y_first, height, DIFFERENTIAL_DIFF_ROWS);
+    y_to = height - y_from > DIFFERENTIAL_DIFF_ROWS ? y_from + DIFFERENTIAL_DIFF_ROWS : height;
+
+    printf("    %u cells differ, first at %u, %u, columns %u to %u and rows %u to %u shown, * where %s differs\n",
+        num_differ, x_first, y_first, x_from, x_to - 1, y_from, y_to - 1, name);
+    printf("    %-*s   %s\n", (int)(x_to - x_from), "reference", name);
+
+    for (uint8_t y = y_from; y < y_to; y++) {
+        printf("    ");
+
+        for (uint8_t x = x_from; x < x_to; x++) putchar(cellChar(reference->getState(x, y)));
+
+        printf("   ");
+
+        for (uint8_t x = x_from; x < x_to; x++) {
+            if (board->getState(x, y) != reference->getState(x, y)) putchar('*');
+            else putchar(cellChar(board->getState(x, y)));
+        }
+
+        printf("\n");
+    }
+
+    printf("    x,y reference/%s:", name);
+
+    num_differ = 0;
+
+    for (uint8_t y = 0; y < height && num_differ < DIFFERENTIAL_DIFF_LISTED; y++) {
+        for (uint8_t x = 0; x < width && num_differ < DIFFERENTIAL_DIFF_LISTED; x++) {
+            if (reference->getState(x, y) == board->getState(x, y)) continue;
+
+            printf(" %u,%u %u/%u", x, y, reference->getState(x, y), board->getState(x, y));
+            num_differ++;
+        }
+    }
+
+    printf("\n");
+}
+
+/**
+ * Truth of `game` being where `reference` is
+ *
+ * @param  {Game *} reference
+ * @param  {Game *} game
+ * @return {bool}
+ */
+static bool same(Game * reference, Game * game) {
+    return reference->getBoard()->hash() == game->getBoard()->hash()
+        && reference->getStats().generation == game->getStats().generation
+        && reference->getStats().population == game->getStats().population;
+}
+
+/**
+ * Nanoseconds spent in `update` by each engine of each group at each size,
+ * over every seed
+ */
+static double nanoseconds[DIFFERENTIAL_NUM_GROUPS][4][DIFFERENTIAL_NUM_SIZES];
+static uint32_t num_generations[DIFFERENTIAL_NUM_GROUPS][DIFFERENTIAL_NUM_SIZES];
+
+/**
+ * Play one seed on every engine of a group in lock step
+ *
+ * @param  {uint8_t}  i_group
+ * @param  {uint8_t}  i_size
+ * @param  {uint32_t} seed
+ * @param  {uint32_t} generations
+ * @return {bool}                  truth of every engine matching throughout
+ */
+static bool play(uint8_t i_group, uint8_t i_size, uint32_t seed, uint32_t generations) {
+    const Group & group = groups[i_group];
+    Game * games[4];
+    bool matched = true;
+    uint32_t i_generation;
+    double started;
+
+    for (uint8_t i_engine = 0; i_engine < group.num_engines; i_engine++) {
+        games[i_engine] = group.engines[i_engine].create(sizes[i_size][0], sizes[i_size][1]);
+        games[i_engine]->init(seed);
+    }
+
+    for (i_generation = 0; i_generation <= generations && matched; i_generation++) {
+        for (uint8_t i_engine = 1; i_engine < group.num_engines; i_engine++) {
+            if (same(games[0], games[i_engine])) continue;
+
+            printf("%s %ux%u seed %u: %s differs from %s after %u updates, round seed %u\n",
+                group.name, sizes[i_size][0], sizes[i_size][1], seed,
+                group.engines[i_engine].name, group.engines[0].name, i_generation,
+                games[0]->getRoundSeed());
+            printf("    generation %u and %u, population %u and %u, hash %08x and %08x\n",
+                games[0]->getStats().generation, games[i_engine]->getStats().generation,
+                games[0]->getStats().population, games[i_engine]->getStats().population,
+                games[0]->getBoard()->hash(), games[i_engine]->getBoard()->hash());
+
+            printCellDiff(games[0]->getBoard(), games[i_engine]->getBoard(), group.engines[i_engine].name);
+
+            matched = false;
+            break;
+        }
+
+        if (!matched || i_generation == generations) break;
+
+        for (uint8_t i_engine = 0; i_engine < group.num_engines; i_engine++) {
+            started = now();
+            games[i_engine]->update();
+            nanoseconds[i_group][i_engine][i_size] += now() - started;
+        }
+
+        num_generations[i_group][i_size]++;
+    }
+
+    for (uint8_t i_engine = 0; i_engine < group.num_engines; i_engine++) {
+        group.engines[i_engine].destroy(games[i_engine]);
+    }
+
+    return matched;
+}
+
+/**
+ * Print nanoseconds a generation of every engine and its speed up on the
+ * reference
+ */
+static void printTable() {
+    double ns_reference;
+    double ns;
+
+    printf("\n%-16s %-10s %7s %12s %12s %8s\n", "group", "engine", "size", "generations", "ns/gen", "speedup");
+
+    for (uint8_t i_group = 0; i_group < DIFFERENTIAL_NUM_GROUPS; i_group++) {
+        for (uint8_t i_size = 0; i_size < DIFFERENTIAL_NUM_SIZES; i_size++) {
+            if (!num_generations[i_group][i_size]) continue;
+
+            ns_reference = nanoseconds[i_group][0][i_size] / num_generations[i_group][i_size];
+
+            for (uint8_t i_engine = 0; i_engine < groups[i_group].num_engines; i_engine++) {
+                ns = nanoseconds[i_group][i_engine][i_size] / num_generations[i_group][i_size];
+
+                printf("%-16s %-10s %3ux%-3u %12u %12.1f %7.2fx\n",
+                    groups[i_group].name, groups[i_group].engines[i_engine].name,
+                    sizes[i_size][0], sizes[i_size][1], num_generations[i_group][i_size],
+                    ns, ns_reference / ns);
+            }
+        }
+    }
+}
+
+
+int main(int argc, char ** argv) {
+    uint32_t generations    = argc > 1 ? atol(argv[1]) : 1000;
+    uint32_t num_seeds      = argc > 2 ? atol(argv[2]) : 3;
+    uint32_t num_cases = 0;
+    uint32_t num_failed = 0;
+
+    printf("differential %s, CELLS_PER_BYTE %u, %u generations, %u seeds\n",
+        DIFFERENTIAL_VARIANT, (unsigned)CELLS_PER_BYTE, generations, num_seeds);
+
+    for (uint8_t i_group = 0; i_group < DIFFERENTIAL_NUM_GROUPS; i_group++) {
+        for (uint8_t i_size = 0; i_size < DIFFERENTIAL_NUM_SIZES; i_size++) {
+            for (uint32_t seed = 1; seed <= num_seeds; seed++) {
+                num_cases++;
+
+                if (!play(i_group, i_size, seed, generations)) num_failed++;
+            }
+
+            fflush(stdout);
+        }
+    }
+
+    printTable();
+
+    printf("\n%u of %u cases matched\n", num_cases - num_failed, num_cases);
+
+    return num_failed ? 1 : 0;
+}
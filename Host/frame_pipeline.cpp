@@ -0,0 +1,147 @@
+/**
+ * Run Conway with each frame sent out to a simulated LED strip, first one step
+ * after the other as `loop` does, then through the FramePipeline so the next
+ * generation is computed while the strip is busy.
+ *
+ *   frame_pipeline [frames] [boards] [us_per_pixel] [generations_per_frame]
+ *
+ * WS2812 pixels take 24 bits at 800kHz, i.e. 30us per pixel. The strip is
+ * sent out by DMA or the like, so sending sleeps rather than spins and leaves
+ * the CPU to the simulation. `generations_per_frame` sets how much is computed
+ * between frames, 0 for as many as take about as long as a frame to send, so
+ * there is as much to overlap as can be.
+ */
+
+#include <Arduino.h>
+
+#include <errno.h>
+#include <time.h>
+
+#include "../Games/Conway.h"
+#include "FramePipeline.h"
+
+
+/**
+ * Seconds on the wall clock
+ *
+ * @return {double} seconds
+ */
+static double now() {
+    struct timespec time;
+
+    clock_gettime(CLOCK_MONOTONIC, &time);
+
+    return time.tv_sec + time.tv_nsec / 1e9;
+}
+
+/**
+ * Sleep for `seconds`, picking up again if interrupted
+ *
+ * @param  {double} seconds
+ */
+static void sleepFor(double seconds) {
+    struct timespec duration;
+
+    duration.tv_sec = (time_t)seconds;
+    duration.tv_nsec = (long)((seconds - duration.tv_sec) * 1e9);
+
+    while (nanosleep(&duration, &duration) != 0 && errno == EINTR) { }
+}
+
+/**
+ * Strip being sent a frame, busy for `us_per_pixel` per pixel like `show`
+ */
+struct Strip {
+    double us_per_pixel;
+    uint32_t num_frames;
+};
+
+/**
+ * Send `frame` to the strip. Only the time it takes is simulated, sleeping
+ * as the CPU is free while a strip is sent, the pixels themselves are not
+ * looked at.
+ *
+ * @param  {const uint8_t *} frame
+ * @param  {uint32_t}        frame_bytes
+ * @param  {void *}          context      Strip
+ */
+static void sendFrame(const uint8_t * frame, uint32_t frame_bytes, void * context) {
+    Strip * strip = (Strip *)context;
+    (void)frame;
+
+    sleepFor(strip->us_per_pixel * (frame_bytes / GAME_PIXEL_BYTES) / 1e6);
+
+    strip->num_frames++;
+}
+
+/**
+ * Generations of a game like `game` that take about `seconds` to compute,
+ * timed on a copy so `game` itself is not stepped
+ *
+ * @param  {uint8_t}  num_boards
+ * @param  {double}   seconds
+ * @return {uint32_t}             generations, at least 1
+ */
+static uint32_t calibrateGenerations(uint8_t num_boards, double seconds) {
+    Conway game = Conway(8, 8, num_boards, num_boards, 6);
+    uint32_t num_generations = 0;
+    double started;
+    double elapsed;
+
+    game.init();
+
+    started = now();
+    do {
+        for (uint8_t i_generation = 0; i_generation < 100; i_generation++) game.update();
+        num_generations += 100;
+        elapsed = now() - started;
+    } while (elapsed < 0.1);
+
+    num_generations = seconds / (elapsed / num_generations);
+
+    return num_generations < 1 ? 1 : num_generations;
+}
+
+int main(int argc, char ** argv) {
+    uint32_t num_frames            = argc > 1 ? atol(argv[1]) : 100;
+    uint8_t num_boards             = argc > 2 ? atoi(argv[2]) : 4;
+    double us_per_pixel            = argc > 3 ? atof(argv[3]) : 30;
+    uint32_t generations_per_frame = argc > 4 ? atol(argv[4]) : 0;
+
+    Conway serial_game = Conway(8, 8, num_boards, num_boards, 6);
+    Conway pipelined_game = Conway(8, 8, num_boards, num_boards, 6);
+    FramePipeline pipeline(&pipelined_game);
+
+    Strip strip = { us_per_pixel, 0 };
+    double started;
+    double serial_seconds;
+    double pipelined_seconds;
+
+    serial_game.init();
+    pipelined_game.init();
+
+    if (generations_per_frame == 0) {
+        generations_per_frame = calibrateGenerations(num_boards, us_per_pixel * serial_game.getNumPixels() / 1e6);
+    }
+
+    started = now();
+    for (uint32_t i_frame = 0; i_frame < num_frames; i_frame++) {
+        serial_game.draw();
+        sendFrame(serial_game.getPixels(), (uint32_t)serial_game.getNumPixels() * GAME_PIXEL_BYTES, &strip);
+        for (uint32_t i_generation = 0; i_generation < generations_per_frame; i_generation++) {
+            serial_game.update();
+        }
+    }
+    serial_seconds = now() - started;
+
+    started = now();
+    pipeline.run(num_frames, sendFrame, &strip, generations_per_frame);
+    pipelined_seconds = now() - started;
+
+    printf("%u pixels, %u frames each, %.0fus per pixel, %u generations per frame\n",
+        serial_game.getNumPixels(), num_frames, us_per_pixel, generations_per_frame);
+    printf("serial:    %.3fs, %.1f frames/s\n", serial_seconds, num_frames / serial_seconds);
+    printf("pipelined: %.3fs, %.1f frames/s\n", pipelined_seconds, num_frames / pipelined_seconds);
+
+    return strip.num_frames == 2 * num_frames ? 0 : 1;
+}
@@ -0,0 +1,226 @@
+/**
+ * Profile a game on the host, or read profile dumps from the board.
+ *
+ *   profile [conway|ant] [frames] [boards]
+ *   profile -d [file|-]
+ *
+ * The first runs `tick` for `frames` frames with GAME_PROFILE on, timing
+ * phases on the wall clock, then reads back its own dump. The second reads
+ * dumps as written by `Game::dumpProfile`, e.g. saved from the serial port
+ * after sending GAME_PROFILE_DUMP_COMMAND. Either prints a report.
+ */
+
+#include <Arduino.h>
+
+#include <time.h>
+
+#include <vector>
+
+
+/**
+ * Microseconds on the wall clock, as the virtual clock doesn't move while
+ * computing
+ *
+ * @return {unsigned long} microseconds
+ */
+static unsigned long wallMicros() {
+    struct timespec time;
+
+    clock_gettime(CLOCK_MONOTONIC, &time);
+
+    return (unsigned long)(time.tv_sec * 1000000ULL + time.tv_nsec / 1000);
+}
+
+#define GAME_PROFILE true
+#define GAME_PROFILE_CLOCK wallMicros
+
+#include "../Games/Conway.h"
+#include "../Games/LangstonsAnt.h"
+
+
+static const char * phase_names[PROFILE_NUM_PHASES] = { "frame", "update", "draw", "show" };
+static const char * counter_names[PROFILE_NUM_COUNTERS] = { "cells", "get_state", "set_state", "pixels" };
+
+
+/**
+ * Everything a dump is written to
+ */
+class BufferPrint : public Print {
+public:
+    std::vector<uint8_t> bytes;
+
+    size_t write(uint8_t value) {
+        bytes.push_back(value);
+        return 1;
+    }
+};
+
+/**
+ * Read a little endian value
+ *
+ * @param  {const uint8_t * &} in         moved past it
+ * @param  {uint8_t}           num_bytes
+ * @return {uint32_t}                     value
+ */
+static uint32_t readValue(const uint8_t * & in, uint8_t num_bytes) {
+    uint32_t value = 0;
+
+    for (uint8_t i_byte = 0; i_byte < num_bytes; i_byte++) value |= (uint32_t)*in++ << (8 * i_byte);
+
+    return value;
+}
+
+/**
+ * Print a report of the dump at `dump`
+ *
+ * @param  {const uint8_t *} dump       starting with "GPRF"
+ * @param  {size_t}          available  bytes from `dump` on
+ * @return {size_t}                     bytes of the dump, 0 if it isn't one
+ */
+static size_t report(const uint8_t * dump, size_t available) {
+    const uint8_t * in = dump + 4;
+    uint8_t num_phases;
+    uint8_t num_buckets;
+    uint8_t num_counters;
+    uint32_t num_frames;
+    uint32_t count;
+    uint32_t total_us;
+    uint32_t max_us;
+    uint32_t bucket;
+    uint32_t last;
+    uint32_t most;
+    uint32_t total;
+    size_t dump_bytes;
+    uint8_t checksum = 0;
+    char label[24];
+
+    if (available < 9 || memcmp(dump, "GPRF", 4) != 0 || dump[4] != PROFILE_DUMP_VERSION) return 0;
+
+    num_phases = dump[5];
+    num_buckets = dump[6];
+    num_counters = dump[7];
+    dump_bytes = 4 + 8 + num_phases * (12 + num_buckets * 2) + num_counters * 12 + 1;
+
+    if (available < dump_bytes) return 0;
+
+    for (size_t i_byte = 4; i_byte < dump_bytes; i_byte++) checksum += dump[i_byte];
+    if (checksum != 0) return 0;
+
+    in += 4;
+    num_frames = readValue(in, 4);
+
+    printf("%u frames\n\n", num_frames);
+    printf("%-10s %10s %12s %10s\n", "phase", "count", "mean us", "max us");
+
+    for (uint8_t i_phase = 0; i_phase < num_phases; i_phase++) {
+        count = readValue(in, 4);
+        total_us = readValue(in, 4);
+        max_us = readValue(in, 4);
+
+        printf("%-10s %10u %12.1f %10u\n",
+            i_phase < PROFILE_NUM_PHASES ? phase_names[i_phase] : "?",
+            count, count ? (double)total_us / count : 0.0, max_us);
+
+        for (uint8_t i_bucket = 0; i_bucket < num_buckets; i_bucket++) {
+            bucket = readValue(in, 2);
+            if (bucket == 0) continue;
+
+            if (i_bucket == 0) snprintf(label, sizeof(label), "< 1us");
+            else if (i_bucket == num_buckets - 1) snprintf(label, sizeof(label), ">= %uus", 1U << (i_bucket - 1));
+            else snprintf(label, sizeof(label), "%u-%uus", 1U << (i_bucket - 1), 1U << i_bucket);
+
+            printf("  %18s %8u %5.1f%%\n", label, bucket, 100.0 * bucket / count);
+        }
+    }
+
+    printf("\n%-10s %12s %12s %12s\n", "counter", "last frame", "most", "mean");
+
+    for (uint8_t i_counter = 0; i_counter < num_counters; i_counter++) {
+        last = readValue(in, 4);
+        most = readValue(in, 4);
+        total = readValue(in, 4);
+
+        printf("%-10s %12u %12u %12.1f\n",
+            i_counter < PROFILE_NUM_COUNTERS ? counter_names[i_counter] : "?",
+            last, most, num_frames ? (double)total / num_frames : 0.0);
+    }
+
+    return dump_bytes;
+}
+
+/**
+ * Report every dump found in a stream
+ *
+ * @param  {const char *} path  file, - for stdin
+ * @return {int}                exit code
+ */
+static int decode(const char * path) {
+    FILE * file = strcmp(path, "-") == 0 ? stdin : fopen(path, "rb");
+    std::vector<uint8_t> bytes;
+    uint8_t chunk[4096];
+    size_t read;
+    size_t dump_bytes;
+    uint32_t num_dumps = 0;
+
+    if (!file) {
+        fprintf(stderr, "can't open %s\n", path);
+        return 1;
+    }
+
+    while ((read = fread(chunk, 1, sizeof(chunk), file)) > 0) bytes.insert(bytes.end(), chunk, chunk + read);
+
+    if (file != stdin) fclose(file);
+
+    for (size_t i_byte = 0; i_byte < bytes.size(); i_byte++) {
+        dump_bytes = report(&bytes[i_byte], bytes.size() - i_byte);
+        if (!dump_bytes) continue;
+
+        num_dumps++;
+        i_byte += dump_bytes - 1;
+        printf("\n");
+    }
+
+    if (!num_dumps) fprintf(stderr, "no dumps found\n");
+
+    return num_dumps ? 0 : 1;
+}
+
+/**
+ * Tick `game` for `num_frames` frames, then report its dump
+ *
+ * @param  {Game *}   game
+ * @param  {uint32_t} num_frames
+ * @return {int}                  exit code
+ */
+static int run(Game * game, uint32_t num_frames) {
+    BufferPrint dump;
+
+    game->init();
+    game_profile.reset();
+
+    for (uint32_t i_frame = 0; i_frame < num_frames; i_frame++) {
+        game->tick();
+        delay(GAME_TICK_MS);
+    }
+
+    game_profile.dump(&dump);
+
+    printf("%ux%u, %zu byte dump\n\n", game->getBoard()->getWidth(), game->getBoard()->getHeight(), dump.bytes.size());
+
+    return report(&dump.bytes[0], dump.bytes.size()) ? 0 : 1;
+}
+
+int main(int argc, char ** argv) {
+    if (argc > 1 && strcmp(argv[1], "-d") == 0) return decode(argc > 2 ? argv[2] : "-");
+
+    const char * name      = argc > 1 ? argv[1] : "conway";
+    uint32_t num_frames    = argc > 2 ? atol(argv[2]) : 1000;
+    uint8_t num_boards     = argc > 3 ? atoi(argv[3]) : 2;
+
+    if (strcmp(name, "conway") == 0) return run(new Conway(8, 8, num_boards, num_boards, 6), num_frames);
+    if (strcmp(name, "ant") == 0) return run(new LangstonsAnt(8, 8, num_boards, num_boards, 6), num_frames);
+
+    fprintf(stderr, "game must be conway or ant\n");
+
+    return 1;
+}
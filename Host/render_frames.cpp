@@ -0,0 +1,89 @@
+/**
+ * Run Conway headless and record every generation as drawn on the LEDs.
+ *
+ *   render_frames [frames] [raw|ppm|strip] [file|-] [boards]
+ *
+ * Stats go to stderr, so frames can be piped to stdout, e.g.
+ *
+ *   render_frames 1000 ppm - | ffplay -f ppm_pipe -
+ */
+
+#include <Arduino.h>
+
+#include <time.h>
+
+#include "../Games/Conway.h"
+#include "FrameWriter.h"
+
+
+/**
+ * Seconds on the wall clock
+ *
+ * @return {double} seconds
+ */
+static double now() {
+    struct timespec time;
+
+    clock_gettime(CLOCK_MONOTONIC, &time);
+
+    return time.tv_sec + time.tv_nsec / 1e9;
+}
+
+int main(int argc, char ** argv) {
+    uint32_t num_frames    = argc > 1 ? atol(argv[1]) : 1000;
+    const char * name      = argc > 2 ? argv[2] : "raw";
+    const char * path      = argc > 3 ? argv[3] : "frames.raw";
+    uint8_t num_boards     = argc > 4 ? atoi(argv[4]) : 4;
+
+    uint8_t format;
+    FILE * file;
+    uint32_t num_shows;
+    double started;
+    double seconds;
+
+    if (strcmp(name, "raw") == 0) format = FRAME_WRITER_RAW;
+    else if (strcmp(name, "ppm") == 0) format = FRAME_WRITER_PPM;
+    else if (strcmp(name, "strip") == 0) format = FRAME_WRITER_STRIP;
+    else {
+        fprintf(stderr, "format must be raw, ppm or strip\n");
+        return 1;
+    }
+
+    file = strcmp(path, "-") == 0 ? stdout : fopen(path, "wb");
+    if (!file) {
+        fprintf(stderr, "can't open %s\n", path);
+        return 1;
+    }
+
+    Conway game = Conway(8, 8, num_boards, num_boards, 6);
+    game.init();
+
+    FrameWriter writer(game.getMatrix(), file, format);
+    writer.attach();
+
+    started = now();
+    for (uint32_t i_frame = 0; i_frame < num_frames; i_frame++) {
+        num_shows = game.getMatrix()->getShowCount();
+
+        game.draw();
+
+        /**
+         * Nothing changed so draw skipped `show`, the LEDs hold the last frame
+         */
+        if (game.getMatrix()->getShowCount() == num_shows) writer.writeFrame();
+
+        game.update();
+    }
+    seconds = now() - started;
+
+    writer.detach();
+    if (file != stdout) fclose(file);
+    else fflush(file);
+
+    fprintf(stderr, "%ux%u, %u frames, %.1f MB\n",
+        game.getMatrix()->width(), game.getMatrix()->height(), writer.getFrames(), writer.getBytes() / 1e6);
+    fprintf(stderr, "total:   %.3fs, %.1f frames/s\n", seconds, writer.getFrames() / seconds);
+    fprintf(stderr, "writing: %.3fs, %.1f MB/s\n", writer.getSeconds(), writer.getBytes() / 1e6 / writer.getSeconds());
+
+    return writer.hasFailed() ? 1 : 0;
+}
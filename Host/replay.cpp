@@ -0,0 +1,227 @@
+/**
+ * Play a recorded session again and check it generation by generation.
+ *
+ *   replay [file|-]
+ *
+ * Reads a log written with GAME_RECORD on, e.g. by `sketch_record` or saved
+ * from the serial port, from `file` or stdin. Lines other than the session's
+ * are skipped. Builds the game named on the session line on a panel that size,
+ * seeds it with the seed logged and runs `tick` on the virtual clock as the
+ * sketch does, comparing every line it records with the log. Stops at the
+ * first line that differs, exiting 1, or once the log is used up.
+ *
+ * The log and this have to be built with the same settings, which the config
+ * on the session line stands for, and the same GAME_RECORD_HASH_INTERVAL.
+ */
+
+#define GAME_RECORD true
+
+#include <Arduino.h>
+
+#include <strings.h>
+#include <time.h>
+
+#include <string>
+#include <vector>
+
+#include "../Games/Conway.h"
+#include "../Games/LangstonsAnt.h"
+
+
+/**
+ * Virtual milliseconds without a line recorded before giving up
+ */
+#define REPLAY_STALL_MS ((uint32_t)(GAME_RECORD_HASH_INTERVAL + 1) * GAME_TICK_MS * 4 + 1000)
+
+
+/**
+ * Microseconds on the wall clock, as the virtual clock doesn't move while
+ * computing
+ *
+ * @return {unsigned long} microseconds
+ */
+static unsigned long wallMicros() {
+    struct timespec time;
+
+    clock_gettime(CLOCK_MONOTONIC, &time);
+
+    return (unsigned long)(time.tv_sec * 1000000ULL + time.tv_nsec / 1000);
+}
+
+/**
+ * Truth of `line` being one Recorder writes
+ *
+ * @param  {const std::string &} line
+ * @return {bool}
+ */
+static bool isSessionLine(const std::string & line) {
+    return line.size() > 2 && line[1] == ' ' && (line[0] == 'S' || line[0] == 'R' || line[0] == 'G');
+}
+
+/**
+ * Everything the replay records, checked line by line against the log. Case
+ * is ignored, as the Arduino core prints hex in upper case.
+ */
+class CheckingPrint : public Print {
+private:
+    const std::vector<std::string> * expected;
+    std::string line;
+
+public:
+    size_t num_checked;
+    size_t num_rounds;
+    size_t num_generations;
+    bool failed;
+    std::string got;
+
+    CheckingPrint(const std::vector<std::string> * _expected) {
+        expected = _expected;
+        num_checked = 0;
+        num_rounds = 0;
+        num_generations = 0;
+        failed = false;
+    }
+
+    bool done() const {
+        return failed || num_checked == expected->size();
+    }
+
+    size_t write(uint8_t value) {
+        if (value == '\r') return 1;
+
+        if (value != '\n') {
+            line += (char)value;
+            return 1;
+        }
+
+        if (!done()) {
+            if (strcasecmp(line.c_str(), (*expected)[num_checked].c_str()) != 0) {
+                failed = true;
+                got = line;
+            }
+            else {
+                if (line[0] == 'R') num_rounds++;
+                if (line[0] == 'G') num_generations++;
+
+                num_checked++;
+            }
+        }
+
+        line.clear();
+
+        return 1;
+    }
+};
+
+
+int main(int argc, char ** argv) {
+    FILE * file = stdin;
+    std::vector<std::string> expected;
+    std::string line;
+    int value;
+    char name[32];
+    unsigned display_width;
+    unsigned display_height;
+    unsigned width;
+    unsigned height;
+    unsigned config;
+    unsigned long seed;
+    Game * game;
+    uint32_t last_ms;
+    size_t last_checked;
+    uint32_t num_frames = 0;
+    unsigned long started;
+    unsigned long elapsed;
+
+    if (argc > 1 && strcmp(argv[1], "-") != 0) {
+        file = fopen(argv[1], "rb");
+
+        if (!file) {
+            fprintf(stderr, "can't open %s\n", argv[1]);
+            return 2;
+        }
+    }
+
+    while ((value = fgetc(file)) != EOF) {
+        if (value == '\r') continue;
+
+        if (value != '\n') {
+            line += (char)value;
+            continue;
+        }
+
+        if (isSessionLine(line)) expected.push_back(line);
+        line.clear();
+    }
+    if (isSessionLine(line)) expected.push_back(line);
+
+    if (file != stdin) fclose(file);
+
+    if (expected.empty() || expected[0][0] != 'S' || sscanf(
+        expected[0].c_str(), "S %31s %u %u %u %u %x %lu",
+        name, &display_width, &display_height, &width, &height, &config, &seed
+    ) != 7) {
+        fprintf(stderr, "no session line at the start of the log\n");
+        return 2;
+    }
+
+    if (strcasecmp(name, "conway") == 0) game = new Conway(display_width, display_height, 1, 1, 6);
+    else if (strcasecmp(name, "langstons_ant") == 0) game = new LangstonsAnt(display_width, display_height, 1, 1, 6);
+    else if (strcasecmp(name, "game") == 0) game = new Game(display_width, display_height, 1, 1, 6);
+    else {
+        fprintf(stderr, "unknown game %s\n", name);
+        return 2;
+    }
+
+    CheckingPrint checker(&expected);
+
+    game->getRecorder()->setOutput(&checker);
+
+    started = wallMicros();
+
+    game->init(seed);
+
+    last_ms = millis();
+    last_checked = checker.num_checked;
+
+    while (!checker.done()) {
+        if (game->tick()) num_frames++;
+
+        delay(1);
+
+        if (checker.num_checked != last_checked) {
+            last_ms = millis();
+            last_checked = checker.num_checked;
+        }
+        else if (millis() - last_ms > REPLAY_STALL_MS) {
+            break;
+        }
+    }
+
+    elapsed = wallMicros() - started;
+
+    if (checker.failed) {
+        printf("line %zu differs\n  log:    %s\n  replay: %s\n",
+            checker.num_checked + 1, expected[checker.num_checked].c_str(), checker.got.c_str());
+
+        if (checker.num_checked == 0) {
+            printf("the session differs, built with other settings than the log? config here %x\n",
+                game->getConfig());
+        }
+
+        return 1;
+    }
+
+    if (checker.num_checked != expected.size()) {
+        printf("line %zu never recorded\n  log:    %s\n",
+            checker.num_checked + 1, expected[checker.num_checked].c_str());
+
+        return 1;
+    }
+
+    printf("ok %s seed %lu, %zu rounds, %zu generations checked, %u frames, %.2f us per frame\n",
+        name, seed, checker.num_rounds, checker.num_generations, num_frames,
+        num_frames ? (double)elapsed / num_frames : 0.0);
+
+    return 0;
+}
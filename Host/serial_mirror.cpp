@@ -0,0 +1,212 @@
+/**
+ * Mirror Conway over a simulated serial link, or decode a recorded stream.
+ *
+ *   serial_mirror [frames] [boards] [baud] [file|-]
+ *   serial_mirror -d [file|-]
+ *
+ * The first runs a generation every GAME_TICK_MS on the virtual clock and
+ * sends it through a link that drains at `baud`, checks the decoded board
+ * against the game after every packet and writes the stream to `file` if
+ * given. The second prints every board decoded from a stream, e.g. recorded
+ * from a running installation with GAME_SERIAL_MIRROR on.
+ */
+
+#define GAME_SERIAL_MIRROR true
+
+#include <Arduino.h>
+
+#include "../Games/Conway.h"
+#include "SerialMirrorDecoder.h"
+
+
+/**
+ * Serial link with a transmit buffer of SERIAL_MIRROR_TX_BUFFER bytes,
+ * draining at the baud rate on the virtual clock. Everything written is fed
+ * to a decoder and optionally a file.
+ */
+class SimulatedLink : public Print {
+private:
+    uint32_t baud;
+    double queued;
+    uint32_t last_us;
+
+    SerialMirrorDecoder * decoder;
+    FILE * file;
+
+    void _drain() {
+        uint32_t now = micros();
+
+        queued -= (now - last_us) * (baud / 10.0) / 1e6;
+        if (queued < 0) queued = 0;
+
+        last_us = now;
+    }
+
+public:
+    uint32_t num_applied;
+    uint32_t num_bytes;
+
+    /**
+     * Bytes written while the buffer was full, that would have made the
+     * sketch wait
+     */
+    uint32_t num_blocked;
+
+    SimulatedLink(uint32_t _baud, SerialMirrorDecoder * _decoder, FILE * _file) {
+        baud = _baud;
+        queued = 0;
+        last_us = micros();
+
+        decoder = _decoder;
+        file = _file;
+
+        num_applied = 0;
+        num_bytes = 0;
+        num_blocked = 0;
+    }
+
+    size_t write(uint8_t value) {
+        _drain();
+
+        if (queued >= SERIAL_MIRROR_TX_BUFFER) num_blocked++;
+        else queued++;
+
+        num_applied += decoder->feed(value);
+        num_bytes++;
+
+        if (file) fputc(value, file);
+
+        return 1;
+    }
+
+    int availableForWrite() {
+        _drain();
+
+        return SERIAL_MIRROR_TX_BUFFER - (int)queued;
+    }
+};
+
+
+/**
+ * Print the decoded board, a character per cell
+ *
+ * @param  {SerialMirrorDecoder &} decoder
+ */
+static void printBoard(SerialMirrorDecoder & decoder) {
+    for (uint8_t y = 0; y < decoder.getHeight(); y++) {
+        for (uint8_t x = 0; x < decoder.getWidth(); x++) {
+            putchar(decoder.getState(x, y) == CELL_STATE_DEAD ? '.' : '0' + decoder.getState(x, y));
+        }
+        putchar('\n');
+    }
+}
+
+/**
+ * Check the decoded board against the game's
+ *
+ * @param  {SerialMirrorDecoder &} decoder
+ * @param  {Board *}               board
+ * @return {bool}                           truth of every cell matching
+ */
+static bool matches(SerialMirrorDecoder & decoder, Board * board) {
+    for (uint8_t y = 0; y < board->getHeight(); y++) {
+        for (uint8_t x = 0; x < board->getWidth(); x++) {
+            if (decoder.getState(x, y) != board->getState(x, y)) return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Print every board decoded from a stream
+ *
+ * @param  {const char *} path  file, - for stdin
+ * @return {int}                exit code
+ */
+static int decode(const char * path) {
+    SerialMirrorDecoder decoder;
+    FILE * file = strcmp(path, "-") == 0 ? stdin : fopen(path, "rb");
+    int value;
+
+    if (!file) {
+        fprintf(stderr, "can't open %s\n", path);
+        return 1;
+    }
+
+    while ((value = fgetc(file)) != EOF) {
+        if (!decoder.feed((uint8_t)value)) continue;
+
+        printf("frame %u\n", decoder.getKeyframes() + decoder.getDeltas());
+        printBoard(decoder);
+    }
+
+    if (file != stdin) fclose(file);
+
+    fprintf(stderr, "%u keyframes, %u deltas, %u errors\n",
+        decoder.getKeyframes(), decoder.getDeltas(), decoder.getErrors());
+
+    return 0;
+}
+
+int main(int argc, char ** argv) {
+    if (argc > 1 && strcmp(argv[1], "-d") == 0) return decode(argc > 2 ? argv[2] : "-");
+
+    uint32_t num_frames    = argc > 1 ? atol(argv[1]) : 1000;
+    uint8_t num_boards     = argc > 2 ? atoi(argv[2]) : 2;
+    uint32_t baud          = argc > 3 ? atol(argv[3]) : 115200;
+    const char * path      = argc > 4 ? argv[4] : NULL;
+
+    SerialMirrorDecoder decoder;
+    FILE * file = NULL;
+    uint32_t num_applied;
+    uint32_t num_mismatched = 0;
+    Board * board;
+
+    if (path) {
+        file = strcmp(path, "-") == 0 ? stdout : fopen(path, "wb");
+        if (!file) {
+            fprintf(stderr, "can't open %s\n", path);
+            return 1;
+        }
+    }
+
+    Conway game = Conway(8, 8, num_boards, num_boards, 6);
+    game.init();
+
+    SimulatedLink link(baud, &decoder, file);
+    game.getSerialMirror()->setOutput(&link);
+
+    board = game.getBoard();
+
+    for (uint32_t i_frame = 0; i_frame < num_frames; i_frame++) {
+        num_applied = link.num_applied;
+
+        game.draw();
+
+        /**
+         * A packet brings the decoder fully up to date
+         */
+        if (link.num_applied != num_applied && !matches(decoder, board)) num_mismatched++;
+
+        game.update();
+
+        delay(GAME_TICK_MS);
+    }
+
+    if (file && file != stdout) fclose(file);
+    else if (file) fflush(file);
+
+    fprintf(stderr, "%ux%u, %u frames at %u baud, every %u ms\n",
+        board->getWidth(), board->getHeight(), num_frames, baud, GAME_TICK_MS);
+    fprintf(stderr, "sent:    %u packets, %u skipped as busy, %.1f bytes/frame, %.1f%% of the link\n",
+        game.getSerialMirror()->getPackets(), game.getSerialMirror()->getSkipped(),
+        (double)link.num_bytes / num_frames,
+        100.0 * link.num_bytes * 10 / baud / (num_frames * GAME_TICK_MS / 1000.0));
+    fprintf(stderr, "blocked: %u bytes written to a full buffer, %.1f ms waiting\n",
+        link.num_blocked, link.num_blocked * 10 * 1000.0 / baud);
+    fprintf(stderr, "decoded: %u keyframes, %u deltas, %u errors, %u mismatched\n",
+        decoder.getKeyframes(), decoder.getDeltas(), decoder.getErrors(), num_mismatched);
+
+    return num_mismatched || decoder.getErrors() ? 1 : 0;
+}
@@ -0,0 +1,36 @@
+/**
+ * Run the sketch as the board would, `setup` then `loop` over and over, on
+ * the virtual clock.
+ *
+ *   sketch [milliseconds] [analog_seed]
+ *
+ * `loop` runs once per virtual millisecond. Anything the sketch prints goes
+ * to stdout, a summary to stderr at the end. The same seed gives the same run.
+ */
+
+#include <Arduino.h>
+
+#include "../arduino-game.ino"
+
+
+int main(int argc, char ** argv) {
+    uint32_t num_ms         = argc > 1 ? atol(argv[1]) : 10000;
+    uint32_t analog_seed    = argc > 2 ? atol(argv[2]) : 12345;
+
+    analogReadSeed(analog_seed);
+
+    setup();
+
+    while (millis() < num_ms) {
+        loop();
+        delay(1);
+    }
+
+    Serial.flush();
+
+    fprintf(stderr, "%u ms, generation %u, population %u, %u shows\n",
+        (uint32_t)millis(), game.getStats().generation, game.getStats().population,
+        game.getMatrix()->getShowCount());
+
+    return 0;
+}
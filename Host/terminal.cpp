@@ -0,0 +1,86 @@
+/**
+ * Watch Conway in the terminal.
+ *
+ *   terminal [frames] [boards] [frames_per_second]
+ *
+ * Needs a terminal with 24-bit color. 0 frames per second runs flat out, stats
+ * go to stderr at the end.
+ */
+
+#include <Arduino.h>
+
+#include <time.h>
+
+#include "../Games/Conway.h"
+#include "TerminalRenderer.h"
+
+
+/**
+ * Seconds on the wall clock
+ *
+ * @return {double} seconds
+ */
+static double now() {
+    struct timespec time;
+
+    clock_gettime(CLOCK_MONOTONIC, &time);
+
+    return time.tv_sec + time.tv_nsec / 1e9;
+}
+
+/**
+ * Wait until `until` on the wall clock
+ *
+ * @param  {double} until  seconds
+ */
+static void sleepUntil(double until) {
+    struct timespec time;
+    double seconds = until - now();
+
+    if (seconds <= 0) return;
+
+    time.tv_sec = (time_t)seconds;
+    time.tv_nsec = (long)((seconds - time.tv_sec) * 1e9);
+
+    nanosleep(&time, NULL);
+}
+
+int main(int argc, char ** argv) {
+    uint32_t num_frames         = argc > 1 ? atol(argv[1]) : 1000;
+    uint8_t num_boards          = argc > 2 ? atoi(argv[2]) : 4;
+    double frames_per_second    = argc > 3 ? atof(argv[3]) : 30;
+
+    double started;
+    double seconds;
+    double render_seconds = 0;
+    double render_started;
+
+    Conway game = Conway(8, 8, num_boards, num_boards, 6);
+    game.init();
+
+    TerminalRenderer renderer(game.getBoard(), game.getColors(), stdout);
+    renderer.begin();
+
+    started = now();
+    for (uint32_t i_frame = 0; i_frame < num_frames; i_frame++) {
+        render_started = now();
+        renderer.render();
+        render_seconds += now() - render_started;
+
+        game.draw();
+        game.update();
+
+        if (frames_per_second > 0) sleepUntil(started + (i_frame + 1) / frames_per_second);
+    }
+    seconds = now() - started;
+
+    renderer.end();
+
+    fprintf(stderr, "%ux%u cells, %u frames, %.1f bytes/frame\n",
+        game.getBoard()->getWidth(), game.getBoard()->getHeight(), renderer.getFrames(),
+        (double)renderer.getBytes() / renderer.getFrames());
+    fprintf(stderr, "total:     %.3fs, %.1f frames/s\n", seconds, num_frames / seconds);
+    fprintf(stderr, "rendering: %.3fs, %.1f frames/s\n", render_seconds, num_frames / render_seconds);
+
+    return 0;
+}
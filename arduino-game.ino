@@ -1,37 +1,95 @@
 /**
- * Delay in ms between rounds
+ * Milliseconds between generations. `loop` never blocks, the game's scheduler
+ * runs a tick whenever one is due.
  */
-#ifndef DELAY
-    #define DELAY 10
-#endif /* DELAY */
+#ifndef GAME_TICK_MS
+    #define GAME_TICK_MS 10
+#endif /* GAME_TICK_MS */
+
+/**
+ * Generations to fast forward without drawing on start up, i.e. skip the
+ * boring start. Stops early if the round ends.
+ */
+#ifndef SKIP_GENERATIONS
+    #define SKIP_GENERATIONS 0
+#endif /* SKIP_GENERATIONS */
+
+/**
+ * Panel the game plays on, `GAME_BOARDS_X` by `GAME_BOARDS_Y` NeoMatrix
+ * boards of `GAME_PIXELS_WIDTH` by `GAME_PIXELS_HEIGHT` LEDs, e.g. 1 by 1 for
+ * a single board. Used by both the game and the SRAM check below.
+ */
+#ifndef GAME_PIXELS_WIDTH
+    #define GAME_PIXELS_WIDTH 8
+#endif /* GAME_PIXELS_WIDTH */
+
+#ifndef GAME_PIXELS_HEIGHT
+    #define GAME_PIXELS_HEIGHT 8
+#endif /* GAME_PIXELS_HEIGHT */
+
+#ifndef GAME_BOARDS_X
+    #define GAME_BOARDS_X 2
+#endif /* GAME_BOARDS_X */
+
+#ifndef GAME_BOARDS_Y
+    #define GAME_BOARDS_Y 2
+#endif /* GAME_BOARDS_Y */
+
+/**
+ * Pin the panel is on
+ */
+#ifndef GAME_PIN
+    #define GAME_PIN 6
+#endif /* GAME_PIN */
 
 // #include "Games/Game.h"
-// Game game = Game(8, 8, 2, 2, 6);
+// Game game = Game(GAME_PIXELS_WIDTH, GAME_PIXELS_HEIGHT, GAME_BOARDS_X, GAME_BOARDS_Y, GAME_PIN);
 
 // #include "Games/Conway.h"
-// Conway game = Conway(8, 8, 1, 1, 6);
-// Conway game = Conway(8, 8, 2, 2, 6);
+// Conway game = Conway(GAME_PIXELS_WIDTH, GAME_PIXELS_HEIGHT, GAME_BOARDS_X, GAME_BOARDS_Y, GAME_PIN);
+
+// #include "Games/ConwayStatic.h"
+// ConwayStatic<GAME_PIXELS_WIDTH, GAME_PIXELS_HEIGHT, GAME_BOARDS_X, GAME_BOARDS_Y> game(GAME_PIN);
 
 #include "Games/LangstonsAnt.h"
-// LangstonsAnt game = LangstonsAnt(8, 8, 1, 1, 6);
-LangstonsAnt game = LangstonsAnt(8, 8, 2, 2, 6);
+LangstonsAnt game = LangstonsAnt(GAME_PIXELS_WIDTH, GAME_PIXELS_HEIGHT, GAME_BOARDS_X, GAME_BOARDS_Y, GAME_PIN);
+
+// #include "Games/LangstonsAntStatic.h"
+// LangstonsAntStatic<GAME_PIXELS_WIDTH, GAME_PIXELS_HEIGHT, GAME_BOARDS_X, GAME_BOARDS_Y> game(GAME_PIN);
 
+/**
+ * Fail the build rather than the board when the game doesn't fit in SRAM, see
+ * Games/Sram.h
+ */
+static_assert(
+    decltype(game)::sram(GAME_PIXELS_WIDTH, GAME_PIXELS_HEIGHT, GAME_BOARDS_X, GAME_BOARDS_Y).fits(),
+    "game needs more SRAM than GAME_SRAM_BYTES less GAME_SRAM_RESERVE"
+);
 
 void setup() {
 
-    #if (GAME_DEBUG)
+    #if (GAME_DEBUG || GAME_PROFILE || GAME_RECORD || GAME_SERIAL_MIRROR)
         Serial.begin(9600);
+    #endif /* GAME_DEBUG || GAME_PROFILE || GAME_RECORD || GAME_SERIAL_MIRROR */
+
+    #if (GAME_DEBUG)
+        decltype(game)::sram(GAME_PIXELS_WIDTH, GAME_PIXELS_HEIGHT, GAME_BOARDS_X, GAME_BOARDS_Y).print(&Serial);
     #endif /* GAME_DEBUG */
 
     game.init();
+
+    #if (SKIP_GENERATIONS > 0)
+        game.advance(SKIP_GENERATIONS);
+    #endif /* SKIP_GENERATIONS */
 }
 
 void loop() {
-    game.draw();
-
-    #if (DELAY > 0)
-        delay(DELAY);
-    #endif /* DELAY */
+    game.tick();
 
-    game.update();
+    /**
+     * Dump the profile when asked to over Serial
+     */
+    #if (GAME_PROFILE)
+        if (Serial.available() > 0 && Serial.read() == GAME_PROFILE_DUMP_COMMAND) game.dumpProfile();
+    #endif /* GAME_PROFILE */
 }